@@ -0,0 +1,68 @@
+#include "Benchmark.h"
+
+#include "hzpch.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+// NOTE: Hazel-Bench [--filter <substring>] [--repetitions <n>] [--warmup <n>] [--min-sample-ms <ms>] [--out <file>]
+// Results are written as JSON to --out, or to stdout when it is not given.
+int main(int argc, char** argv)
+{
+    Hazel::BenchmarkSettings settings;
+    const char* outputPath = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* argument = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (!value)
+        {
+            std::cerr << "Missing value for " << argument << '\n';
+            return 1;
+        }
+
+        if (std::strcmp(argument, "--filter") == 0)
+            settings.Filter = value;
+        else if (std::strcmp(argument, "--repetitions") == 0)
+            settings.Repetitions = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (std::strcmp(argument, "--warmup") == 0)
+            settings.Warmup = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (std::strcmp(argument, "--min-sample-ms") == 0)
+            settings.MinSampleMilliseconds = std::strtod(value, nullptr);
+        else if (std::strcmp(argument, "--out") == 0)
+            outputPath = value;
+        else
+        {
+            std::cerr << "Unknown argument " << argument << '\n';
+            return 1;
+        }
+        i++;
+    }
+
+    // NOTE: Engine code logs; keep stdout to the JSON unless something actually goes wrong
+    Hazel::Log::Init();
+    Hazel::Log::GetCoreLogger()->set_level(spdlog::level::warn);
+    Hazel::Log::GetClientLogger()->set_level(spdlog::level::warn);
+
+    const std::vector<Hazel::BenchmarkResult> results = Hazel::BenchmarkRegistry::RunAll(settings);
+    Hazel::Log::Shutdown();
+
+    if (outputPath)
+    {
+        std::ofstream stream(outputPath);
+        if (!stream)
+        {
+            std::cerr << "Could not open " << outputPath << '\n';
+            return 1;
+        }
+        Hazel::BenchmarkRegistry::WriteJSON(stream, settings, results);
+    }
+    else
+    {
+        Hazel::BenchmarkRegistry::WriteJSON(std::cout, settings, results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+
+namespace Hazel
+{
+
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+struct Registration
+{
+    const char* Name;
+    BenchmarkFunction Function;
+};
+} // namespace
+
+// NOTE: Function-local so registrars in other translation units never see it unconstructed
+static std::vector<Registration>& GetRegistrations()
+{
+    static std::vector<Registration> s_Registrations;
+    return s_Registrations;
+}
+
+static double TimeBatch(const std::function<void(uint64_t)>& batch, uint64_t iterations)
+{
+    const Clock::time_point start = Clock::now();
+    batch(iterations);
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// NOTE: Reorders values
+static double Median(std::vector<double>& values)
+{
+    const size_t middle = values.size() / 2;
+    std::nth_element(values.begin(), values.begin() + middle, values.end());
+    if (values.size() % 2 != 0)
+        return values[middle];
+
+    const double upper = values[middle];
+    const double lower = *std::max_element(values.begin(), values.begin() + middle);
+    return (lower + upper) * 0.5;
+}
+
+Benchmark::Benchmark(const std::string& name, const BenchmarkSettings& settings) : m_Settings(settings)
+{
+    m_Result.Name = name;
+}
+
+void Benchmark::Measure(const std::function<void(uint64_t)>& batch)
+{
+    // NOTE: Grow the batch until one sample is long enough that timer resolution and call overhead vanish
+    const double minSampleNanoseconds = m_Settings.MinSampleMilliseconds * 1e6;
+    uint64_t iterations = 1;
+    for (;;)
+    {
+        const double elapsed = TimeBatch(batch, iterations);
+        if (elapsed >= minSampleNanoseconds || iterations >= (1ull << 40))
+            break;
+
+        const double scale = elapsed > 0.0 ? minSampleNanoseconds / elapsed * 1.2 : 10.0;
+        iterations = static_cast<uint64_t>(std::ceil(iterations * std::min(std::max(scale, 2.0), 10.0)));
+    }
+
+    for (uint32_t i = 0; i < m_Settings.Warmup; i++)
+        TimeBatch(batch, iterations);
+
+    const uint32_t repetitions = std::max(m_Settings.Repetitions, 1u);
+    std::vector<double> samples(repetitions);
+    for (double& sample : samples)
+        sample = TimeBatch(batch, iterations) / static_cast<double>(iterations);
+
+    m_Result.Iterations = iterations;
+    m_Result.Samples = repetitions;
+    m_Result.Min = *std::min_element(samples.begin(), samples.end());
+    m_Result.Max = *std::max_element(samples.begin(), samples.end());
+    m_Result.Median = Median(samples);
+
+    for (double& sample : samples)
+        sample = std::abs(sample - m_Result.Median);
+    m_Result.MAD = Median(samples);
+}
+
+void BenchmarkRegistry::Register(const char* name, BenchmarkFunction function)
+{
+    GetRegistrations().push_back({name, function});
+}
+
+std::vector<BenchmarkResult> BenchmarkRegistry::RunAll(const BenchmarkSettings& settings)
+{
+    std::vector<Registration> registrations = GetRegistrations();
+    std::sort(registrations.begin(), registrations.end(), [](const Registration& a, const Registration& b) {
+        return std::string(a.Name) < std::string(b.Name);
+    });
+
+    std::vector<BenchmarkResult> results;
+    for (const Registration& registration : registrations)
+    {
+        if (!settings.Filter.empty() && std::string(registration.Name).find(settings.Filter) == std::string::npos)
+            continue;
+
+        Benchmark bench(registration.Name, settings);
+        registration.Function(bench);
+        if (bench.GetResult().Samples > 0)
+            results.push_back(bench.GetResult());
+    }
+
+    return results;
+}
+
+void BenchmarkRegistry::WriteJSON(std::ostream& stream, const BenchmarkSettings& settings,
+                                  const std::vector<BenchmarkResult>& results)
+{
+    const std::time_t now = std::time(nullptr);
+    char date[32] = {};
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+#if defined(HZ_DEBUG)
+    const char* build = "Debug";
+#elif defined(HZ_RELEASE)
+    const char* build = "Release";
+#else
+    const char* build = "Dist";
+#endif
+
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\n";
+    stream << "  \"context\": {\"date\": \"" << date << "\", \"build\": \"" << build
+           << "\", \"warmup\": " << settings.Warmup << ", \"repetitions\": " << settings.Repetitions
+           << ", \"min_sample_ms\": " << settings.MinSampleMilliseconds << "},\n";
+    stream << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const BenchmarkResult& result = results[i];
+        stream << (i == 0 ? "\n" : ",\n");
+        stream << "    {\"name\": \"" << result.Name << "\", \"iterations\": " << result.Iterations
+               << ", \"samples\": " << result.Samples << ", \"median_ns\": " << result.Median
+               << ", \"mad_ns\": " << result.MAD << ", \"min_ns\": " << result.Min << ", \"max_ns\": " << result.Max
+               << "}";
+    }
+    stream << "\n  ]\n}\n";
+}
+
+} // namespace Hazel
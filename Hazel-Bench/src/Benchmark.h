@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Hazel
+{
+
+// NOTE: Keeps the compiler from proving a value unused and deleting the work that produced it
+template <typename T> inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile char* bytes = reinterpret_cast<const volatile char*>(&value);
+    (void)*bytes;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+struct BenchmarkSettings
+{
+    uint32_t Warmup = 3;       // NOTE: Samples taken and discarded before measuring
+    uint32_t Repetitions = 21; // NOTE: Measured samples; odd so the median is a real sample
+    double MinSampleMilliseconds = 5.0;
+    std::string Filter; // NOTE: Substring of the benchmark name; empty runs everything
+};
+
+// NOTE: Nanoseconds per iteration over all measured samples. MAD is the median absolute deviation from the
+// median, which unlike the standard deviation is not dragged around by the occasional preempted sample.
+struct BenchmarkResult
+{
+    std::string Name;
+    uint64_t Iterations = 0; // NOTE: Per sample, calibrated so one sample lasts MinSampleMilliseconds
+    uint32_t Samples = 0;
+    double Median = 0.0;
+    double MAD = 0.0;
+    double Min = 0.0;
+    double Max = 0.0;
+};
+
+// NOTE: Handed to each benchmark. Setup happens before Run and is not timed; Run calls the body in a tight
+// loop, first to calibrate the iteration count, then for the warmup and measured samples.
+class Benchmark
+{
+public:
+    Benchmark(const std::string& name, const BenchmarkSettings& settings);
+
+    template <typename Body> void Run(Body&& body)
+    {
+        Measure([&body](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++)
+                body();
+        });
+    }
+
+    const BenchmarkResult& GetResult() const
+    {
+        return m_Result;
+    }
+
+private:
+    void Measure(const std::function<void(uint64_t)>& batch);
+
+private:
+    const BenchmarkSettings& m_Settings;
+    BenchmarkResult m_Result;
+};
+
+using BenchmarkFunction = void (*)(Benchmark&);
+
+class BenchmarkRegistry
+{
+public:
+    static void Register(const char* name, BenchmarkFunction function);
+
+    static std::vector<BenchmarkResult> RunAll(const BenchmarkSettings& settings);
+    static void WriteJSON(std::ostream& stream, const BenchmarkSettings& settings,
+                          const std::vector<BenchmarkResult>& results);
+};
+
+struct BenchmarkRegistrar
+{
+    BenchmarkRegistrar(const char* name, BenchmarkFunction function)
+    {
+        BenchmarkRegistry::Register(name, function);
+    }
+};
+
+} // namespace Hazel
+
+#define HZ_BENCHMARK(name)                                                                                             \
+    static void name(::Hazel::Benchmark& bench);                                                                       \
+    static ::Hazel::BenchmarkRegistrar s_##name##Registrar(#name, name);                                               \
+    static void name(::Hazel::Benchmark& bench)
@@ -0,0 +1,86 @@
+#include "Benchmark.h"
+
+#include "hzpch.h"
+
+#include "Hazel/Core/FileSystem.h"
+#include "Hazel/Core/JobSystem.h"
+
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/glm.hpp>
+
+namespace Hazel
+{
+
+HZ_BENCHMARK(FileSystem_ResolvePathHit)
+{
+    // NOTE: Resolved from the working directory, the Sandbox folder or next to the executable
+    const std::filesystem::path path = "assets/shaders/Texture.glsl";
+    bench.Run([&path]() {
+        auto resolved = FileSystem::ResolvePath(path);
+        DoNotOptimize(resolved);
+    });
+}
+
+HZ_BENCHMARK(FileSystem_ResolvePathMiss)
+{
+    // NOTE: Worst case; every candidate directory is probed
+    const std::filesystem::path path = "assets/does/not/exist.glsl";
+    bench.Run([&path]() {
+        auto resolved = FileSystem::ResolvePath(path);
+        DoNotOptimize(resolved);
+    });
+}
+
+// NOTE: A scene's worth of per-frame transform updates
+static constexpr uint32_t s_TransformCount = 64 * 1024;
+
+static void UpdateTransforms(std::vector<glm::mat4>& transforms, float time, uint32_t begin, uint32_t end)
+{
+    for (uint32_t i = begin; i < end; i++)
+    {
+        const glm::vec3 position(static_cast<float>(i % 256), static_cast<float>(i / 256), 0.0f);
+        transforms[i] = glm::translate(glm::mat4(1.0f), position) *
+                        glm::rotate(glm::mat4(1.0f), time + i * 0.01f, glm::vec3(0.0f, 0.0f, 1.0f)) *
+                        glm::scale(glm::mat4(1.0f), glm::vec3(0.5f));
+    }
+}
+
+HZ_BENCHMARK(JobSystem_TransformsSerial)
+{
+    std::vector<glm::mat4> transforms(s_TransformCount);
+    float time = 0.0f;
+    bench.Run([&]() {
+        UpdateTransforms(transforms, time += 0.016f, 0, s_TransformCount);
+        DoNotOptimize(transforms.data());
+    });
+}
+
+HZ_BENCHMARK(JobSystem_TransformsParallelFor)
+{
+    if (!JobSystem::IsRunning())
+        JobSystem::Init();
+
+    std::vector<glm::mat4> transforms(s_TransformCount);
+    float time = 0.0f;
+    bench.Run([&]() {
+        time += 0.016f;
+        JobSystem::ParallelFor(s_TransformCount, 1024, [&transforms, time](uint32_t begin, uint32_t end) {
+            UpdateTransforms(transforms, time, begin, end);
+        });
+        DoNotOptimize(transforms.data());
+    });
+}
+
+HZ_BENCHMARK(JobSystem_SubmitWaitEmpty)
+{
+    if (!JobSystem::IsRunning())
+        JobSystem::Init();
+
+    bench.Run([]() {
+        JobCounter counter;
+        JobSystem::Submit([]() {}, &counter);
+        JobSystem::Wait(counter);
+    });
+}
+
+} // namespace Hazel
@@ -0,0 +1,143 @@
+#include "Benchmark.h"
+
+#include "hzpch.h"
+
+#include "Hazel/Core/Application.h"
+#include "Hazel/Events/EventQueue.h"
+#include "Hazel/Events/KeyEvent.h"
+#include "Hazel/Events/MouseEvent.h"
+
+namespace Hazel
+{
+
+// NOTE: Handles key presses only, so mouse events travel through every layer unless the layer subscribes to
+// keyboard events alone
+class KeyListenerLayer : public Layer
+{
+public:
+    KeyListenerLayer(int eventCategories = EventCategoryAll) : Layer("KeyListener", eventCategories)
+    {
+    }
+
+    virtual void OnEvent(Event& event) override
+    {
+        EventDispatcher dispatcher(event);
+        dispatcher.Dispatch<KeyPressedEvent>([this](KeyPressedEvent& e) {
+            m_LastKey = e.GetKeyCode();
+            return false;
+        });
+    }
+
+private:
+    int m_LastKey = 0;
+};
+
+HZ_BENCHMARK(EventDispatcher_DispatchMatch)
+{
+    KeyPressedEvent event(65, 0);
+    int handled = 0;
+    bench.Run([&]() {
+        EventDispatcher dispatcher(event);
+        dispatcher.Dispatch<KeyPressedEvent>([&handled](KeyPressedEvent& e) {
+            handled += e.GetKeyCode();
+            return false;
+        });
+        DoNotOptimize(handled);
+    });
+}
+
+HZ_BENCHMARK(EventDispatcher_DispatchMismatch)
+{
+    MouseMovedEvent event(1.0f, 2.0f);
+    int handled = 0;
+    bench.Run([&]() {
+        EventDispatcher dispatcher(event);
+        dispatcher.Dispatch<KeyPressedEvent>([&handled](KeyPressedEvent& e) {
+            handled += e.GetKeyCode();
+            return false;
+        });
+        DoNotOptimize(handled);
+    });
+}
+
+// NOTE: A frame of fast mouse movement: 32 moves pushed and drained
+HZ_BENCHMARK(EventQueue_PushDrain32Moves)
+{
+    EventQueue queue;
+    int dispatched = 0;
+    bench.Run([&]() {
+        for (int i = 0; i < 32; i++)
+            queue.Push(MouseMovedEvent(static_cast<float>(i), 2.0f));
+        queue.Drain([&dispatched](Event&) { dispatched++; });
+        DoNotOptimize(dispatched);
+    });
+}
+
+HZ_BENCHMARK(EventQueue_PushDrain32MovesUncoalesced)
+{
+    EventQueue queue;
+    queue.SetCoalescing(false);
+    int dispatched = 0;
+    bench.Run([&]() {
+        for (int i = 0; i < 32; i++)
+            queue.Push(MouseMovedEvent(static_cast<float>(i), 2.0f));
+        queue.Drain([&dispatched](Event&) { dispatched++; });
+        DoNotOptimize(dispatched);
+    });
+}
+
+// NOTE: Headless, so this runs on machines without a display. Only one Application may exist at a time, so the
+// benchmarks below share it; it is deliberately never destroyed.
+static Application& GetLayerStack64Application(std::vector<Layer*>& layers)
+{
+    static std::vector<Layer*> s_Layers;
+    static Application* s_Application = nullptr;
+    if (!s_Application)
+    {
+        ApplicationSpecification specification;
+        specification.Headless = true;
+        s_Application = new Application(specification);
+        for (int i = 0; i < 64; i++)
+        {
+            s_Layers.push_back(new KeyListenerLayer());
+            if (i < 56)
+                s_Application->PushLayer(s_Layers.back());
+            else
+                s_Application->PushOverlay(s_Layers.back());
+        }
+    }
+
+    layers = s_Layers;
+    return *s_Application;
+}
+
+HZ_BENCHMARK(Application_OnEventLayerStack64)
+{
+    std::vector<Layer*> layers;
+    Application& app = GetLayerStack64Application(layers);
+    for (Layer* layer : layers)
+        layer->SetEventCategories(EventCategoryAll);
+
+    bench.Run([&]() {
+        MouseMovedEvent event(1.0f, 2.0f);
+        app.OnEvent(event);
+        DoNotOptimize(event);
+    });
+}
+
+// NOTE: The same stack with every layer subscribed to keyboard events only, so mouse events skip them all
+HZ_BENCHMARK(Application_OnEventLayerStack64Unsubscribed)
+{
+    std::vector<Layer*> layers;
+    Application& app = GetLayerStack64Application(layers);
+    for (Layer* layer : layers)
+        layer->SetEventCategories(EventCategoryKeyboard);
+
+    bench.Run([&]() {
+        MouseMovedEvent event(1.0f, 2.0f);
+        app.OnEvent(event);
+        DoNotOptimize(event);
+    });
+}
+
+} // namespace Hazel
@@ -0,0 +1,51 @@
+#include "Benchmark.h"
+
+#include "hzpch.h"
+
+#include "Hazel/Renderer/Buffer.h"
+#include "Hazel/Renderer/OrthographicCamera.h"
+#include "Platform/OpenGL/OpenGLShader.h"
+
+namespace Hazel
+{
+
+HZ_BENCHMARK(BufferLayout_Construct)
+{
+    bench.Run([]() {
+        BufferLayout layout = {{ShaderDataType::Float3, "a_Position"},
+                               {ShaderDataType::Float4, "a_Color"},
+                               {ShaderDataType::Float2, "a_TexCoord"},
+                               {ShaderDataType::Float, "a_TexIndex"},
+                               {ShaderDataType::Mat4, "a_Transform", false, 1}};
+        DoNotOptimize(layout);
+    });
+}
+
+HZ_BENCHMARK(OpenGLShader_PreProcessLarge)
+{
+    // NOTE: Roughly 200 KB per stage, far beyond any shader in the repo, so scanning cost dominates
+    std::string body;
+    for (int i = 0; i < 4096; i++)
+        body += "uniform vec4 u_Value" + std::to_string(i) + "; // padding to make the source large\n";
+
+    const std::string source = "#type vertex\n#version 330 core\n" + body + "void main() {}\n" +
+                               "#type fragment\n#version 330 core\n" + body + "void main() {}\n";
+    bench.Run([&source]() {
+        auto sources = OpenGLShader::PreProcess(source);
+        DoNotOptimize(sources);
+    });
+}
+
+HZ_BENCHMARK(OrthographicCamera_Recalculate)
+{
+    OrthographicCamera camera(-1.6f, 1.6f, -0.9f, 0.9f);
+    float angle = 0.0f;
+    bench.Run([&]() {
+        angle += 0.5f;
+        camera.SetPosition({angle * 0.01f, 0.0f, 0.0f});
+        camera.SetRotation(angle);
+        DoNotOptimize(camera.GetViewProjectionMatrix());
+    });
+}
+
+} // namespace Hazel
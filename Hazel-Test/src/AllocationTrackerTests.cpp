@@ -0,0 +1,105 @@
+#include "catch.hpp"
+
+#include "hzpch.h"
+
+#include "Hazel/Debug/AllocationTracker.h"
+
+namespace Hazel
+{
+
+// NOTE: Drives the counters directly, so these hold whether or not the operator new hooks are compiled in.
+// With HZ_TRACK_MEMORY the test itself allocates too, so only deltas of tagged counters are compared.
+
+static const AllocationTagStatistics& FindTag(const std::vector<AllocationTagStatistics>& tags, uint8_t tag)
+{
+    REQUIRE(tag < tags.size());
+    return tags[tag];
+}
+
+TEST_CASE("AllocationTracker registers each tag name once", "[AllocationTracker]")
+{
+    const uint8_t renderer = AllocationTracker::RegisterTag("TestRenderer");
+    REQUIRE(renderer != 0);
+    REQUIRE(AllocationTracker::RegisterTag("TestRenderer") == renderer);
+
+    std::string copy = "TestRenderer";
+    REQUIRE(AllocationTracker::RegisterTag(copy.c_str()) == renderer);
+    REQUIRE(AllocationTracker::RegisterTag("TestAudio") != renderer);
+
+    const std::vector<AllocationTagStatistics> tags = AllocationTracker::GetTagStatistics();
+    REQUIRE(std::string(tags[0].Name) == "Untagged");
+    REQUIRE(std::string(FindTag(tags, renderer).Name) == "TestRenderer");
+}
+
+TEST_CASE("AllocationTracker charges allocations to the current scope and frees back to the allocating tag",
+          "[AllocationTracker]")
+{
+    const uint8_t tag = AllocationTracker::RegisterTag("TestScoped");
+    const AllocationTagStatistics before = FindTag(AllocationTracker::GetTagStatistics(), tag);
+
+    REQUIRE(AllocationTracker::GetCurrentTag() == 0);
+    {
+        MemoryScope scope(tag);
+        REQUIRE(AllocationTracker::GetCurrentTag() == tag);
+        AllocationTracker::OnAllocate(64, AllocationTracker::GetCurrentTag());
+        AllocationTracker::OnAllocate(32, AllocationTracker::GetCurrentTag());
+    }
+    REQUIRE(AllocationTracker::GetCurrentTag() == 0);
+    AllocationTracker::OnFree(32, tag);
+
+    const AllocationTagStatistics after = FindTag(AllocationTracker::GetTagStatistics(), tag);
+    REQUIRE(after.Allocations - before.Allocations == 2);
+    REQUIRE(after.Bytes - before.Bytes == 96);
+    REQUIRE(after.LiveBytes - before.LiveBytes == 64);
+
+    AllocationTracker::OnFree(64, tag);
+}
+
+TEST_CASE("AllocationTracker reports the previous frame and keeps the peak", "[AllocationTracker]")
+{
+    const uint8_t tag = AllocationTracker::RegisterTag("TestFrame");
+    AllocationTracker::BeginFrame();
+
+    AllocationTracker::OnAllocate(1 << 20, tag);
+    AllocationTracker::OnAllocate(1 << 20, tag);
+    const uint64_t peak = AllocationTracker::GetStatistics().LiveBytes;
+    AllocationTracker::OnFree(1 << 20, tag);
+    AllocationTracker::OnFree(1 << 20, tag);
+
+    AllocationTracker::BeginFrame();
+
+    const AllocationTagStatistics frame = FindTag(AllocationTracker::GetTagStatistics(), tag);
+    REQUIRE(frame.FrameAllocations == 2);
+    REQUIRE(frame.FrameBytes == 2u << 20);
+    REQUIRE(frame.LiveBytes == 0);
+
+    const AllocationStatistics stats = AllocationTracker::GetStatistics();
+    REQUIRE(stats.FrameAllocations >= 2);
+    REQUIRE(stats.PeakBytes >= peak);
+
+    AllocationTracker::BeginFrame();
+    REQUIRE(FindTag(AllocationTracker::GetTagStatistics(), tag).FrameAllocations == 0);
+}
+
+TEST_CASE("AllocationTracker stack capture stays off without the hooks", "[AllocationTracker]")
+{
+    AllocationTracker::SetStackCapture(true);
+    REQUIRE(AllocationTracker::IsStackCaptureEnabled() == AllocationTracker::IsEnabled());
+
+    if (AllocationTracker::IsEnabled())
+    {
+        std::vector<int>* values = new std::vector<int>(16);
+        delete values;
+        REQUIRE_FALSE(AllocationTracker::GetTopStacks(4).empty());
+    }
+    else
+    {
+        REQUIRE(AllocationTracker::GetTopStacks(4).empty());
+    }
+
+    AllocationTracker::SetStackCapture(false);
+    AllocationTracker::ResetStacks();
+    REQUIRE(AllocationTracker::GetTopStacks(4).empty());
+}
+
+} // namespace Hazel
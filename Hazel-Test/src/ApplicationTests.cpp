@@ -0,0 +1,87 @@
+#include "catch.hpp"
+
+#include "hzpch.h"
+
+#include "Hazel/Core/Application.h"
+#include "Hazel/Renderer/RendererAPI.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace Hazel
+{
+
+class FrameCountingLayer : public Layer
+{
+public:
+    std::atomic<uint32_t> Frames{0};
+
+    FrameCountingLayer() : Layer("FrameCounting")
+    {
+    }
+
+    void OnUpdate(Timestep timestep) override
+    {
+        Frames++;
+    }
+};
+
+// NOTE: Polls for up to a second; the frames this waits on come from another thread
+static bool WaitForFrames(const FrameCountingLayer& layer, uint32_t frames)
+{
+    for (int i = 0; i < 1000 && layer.Frames.load() < frames; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return layer.Frames.load() >= frames;
+}
+
+TEST_CASE("Application rendering on demand draws only the frames it was asked for", "[Application]")
+{
+    ApplicationSpecification specification;
+    specification.Headless = true;
+    specification.RenderOnDemand = true;
+    // NOTE: Long enough that a frame drawn without a request would be a timeout, not a wakeup
+    specification.OnDemandWaitTimeout = 10.0;
+    specification.Jobs.WorkerCount = 0;
+
+    uint32_t startupFrames = 0, idleFrames = 0, invalidatedFrames = 0, requestedFrames = 0;
+    {
+        Application application(specification);
+        FrameCountingLayer* layer = new FrameCountingLayer();
+        application.PushLayer(layer);
+
+        // NOTE: Catch assertions are not thread safe, so the driver only records what it saw
+        std::thread driver([&]() {
+            WaitForFrames(*layer, 2);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            startupFrames = layer->Frames.load();
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            idleFrames = layer->Frames.load();
+
+            application.Invalidate();
+            WaitForFrames(*layer, idleFrames + 1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            invalidatedFrames = layer->Frames.load();
+
+            application.RequestFrames(3);
+            application.RequestFrames(2); // NOTE: Requests are not added up; the larger one wins
+            WaitForFrames(*layer, invalidatedFrames + 3);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            requestedFrames = layer->Frames.load();
+
+            application.Close();
+        });
+
+        application.Run();
+        driver.join();
+    }
+    RendererAPI::SetAPI(RendererAPI::API::OpenGL);
+
+    REQUIRE(startupFrames == 2);
+    REQUIRE(idleFrames == startupFrames);
+    REQUIRE(invalidatedFrames == idleFrames + 1);
+    REQUIRE(requestedFrames == invalidatedFrames + 3);
+}
+
+} // namespace Hazel
@@ -61,4 +61,31 @@ TEST_CASE("BufferLayout calculates element offsets and stride", "[Buffer]")
     REQUIRE(elements[3].Offset == 36);
     REQUIRE(elements[3].Size == 4);
 }
+
+TEST_CASE("BufferElement matrices span one attribute location per column", "[Buffer]")
+{
+    REQUIRE(BufferElement(ShaderDataType::Float4, "f4").GetLocationCount() == 1);
+    REQUIRE(BufferElement(ShaderDataType::Mat3, "m3").GetLocationCount() == 3);
+    REQUIRE(BufferElement(ShaderDataType::Mat4, "m4").GetLocationCount() == 4);
+    REQUIRE(BufferElement(ShaderDataType::Int4, "i4").GetLocationCount() == 1);
+
+    REQUIRE(BufferElement(ShaderDataType::Int2, "i2").IsInteger());
+    REQUIRE_FALSE(BufferElement(ShaderDataType::Float2, "f2").IsInteger());
+    REQUIRE_FALSE(BufferElement(ShaderDataType::Bool, "b").IsInteger());
+}
+
+TEST_CASE("BufferLayout keeps per-instance divisors", "[Buffer]")
+{
+    BufferLayout layout = {{ShaderDataType::Mat4, "a_InstanceTransform", false, 1},
+                           {ShaderDataType::Float4, "a_InstanceColor", false, 1}};
+
+    REQUIRE(layout.GetStride() == 80);
+
+    const auto& elements = layout.GetElements();
+    REQUIRE(elements[0].Divisor == 1);
+    REQUIRE(elements[1].Divisor == 1);
+    REQUIRE(elements[1].Offset == 64);
+
+    REQUIRE(BufferElement(ShaderDataType::Float3, "a_Position").Divisor == 0);
+}
 } // namespace Hazel
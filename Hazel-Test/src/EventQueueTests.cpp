@@ -0,0 +1,99 @@
+#include "catch.hpp"
+
+#include "Hazel/Events/ApplicationEvent.h"
+#include "Hazel/Events/EventQueue.h"
+#include "Hazel/Events/KeyEvent.h"
+#include "Hazel/Events/MouseEvent.h"
+
+#include <vector>
+
+namespace Hazel
+{
+
+TEST_CASE("EventQueue coalesces consecutive moves, scrolls and resizes", "[EventQueue]")
+{
+    EventQueue queue;
+    queue.Push(MouseMovedEvent(1.0f, 1.0f));
+    queue.Push(MouseMovedEvent(2.0f, 3.0f));
+    queue.Push(MouseScrolledEvent(0.0f, 1.0f));
+    queue.Push(MouseScrolledEvent(0.5f, 2.0f));
+    queue.Push(WindowResizeEvent(800, 600));
+    queue.Push(WindowResizeEvent(1024, 768));
+
+    REQUIRE(queue.GetSize() == 3);
+    REQUIRE(queue.GetCoalescedCount() == 3);
+
+    std::vector<EventType> types;
+    queue.Drain([&types](Event& event) {
+        types.push_back(event.GetEventType());
+
+        EventDispatcher dispatcher(event);
+        dispatcher.Dispatch<MouseMovedEvent>([](MouseMovedEvent& e) {
+            REQUIRE(e.GetX() == 2.0f);
+            REQUIRE(e.GetY() == 3.0f);
+            return false;
+        });
+        dispatcher.Dispatch<MouseScrolledEvent>([](MouseScrolledEvent& e) {
+            REQUIRE(e.GetXOffset() == 0.5f);
+            REQUIRE(e.GetYOffset() == 3.0f);
+            return false;
+        });
+        dispatcher.Dispatch<WindowResizeEvent>([](WindowResizeEvent& e) {
+            REQUIRE(e.GetWidth() == 1024);
+            REQUIRE(e.GetHeight() == 768);
+            return false;
+        });
+    });
+
+    REQUIRE(types ==
+            std::vector<EventType>{EventType::MouseMoved, EventType::MouseScrolled, EventType::WindowResize});
+    REQUIRE(queue.GetSize() == 0);
+}
+
+TEST_CASE("EventQueue keeps order across events that do not coalesce", "[EventQueue]")
+{
+    EventQueue queue;
+    queue.Push(MouseMovedEvent(1.0f, 1.0f));
+    queue.Push(MouseButtonPressedEvent(0));
+    queue.Push(MouseMovedEvent(2.0f, 2.0f));
+    queue.Push(KeyPressedEvent(65, 0));
+    queue.Push(KeyPressedEvent(65, 1));
+
+    std::vector<EventType> types;
+    queue.Drain([&types](Event& event) { types.push_back(event.GetEventType()); });
+
+    REQUIRE(types == std::vector<EventType>{EventType::MouseMoved, EventType::MouseButtonPressed,
+                                            EventType::MouseMoved, EventType::KeyPressed, EventType::KeyPressed});
+    REQUIRE(queue.GetCoalescedCount() == 0);
+}
+
+TEST_CASE("EventQueue without coalescing delivers every event", "[EventQueue]")
+{
+    EventQueue queue;
+    queue.SetCoalescing(false);
+    for (int i = 0; i < 4; i++)
+        queue.Push(MouseMovedEvent(static_cast<float>(i), 0.0f));
+
+    int dispatched = 0;
+    queue.Drain([&dispatched](Event&) { dispatched++; });
+
+    REQUIRE(dispatched == 4);
+}
+
+TEST_CASE("EventQueue dispatches events pushed while draining", "[EventQueue]")
+{
+    EventQueue queue;
+    queue.Push(MouseMovedEvent(1.0f, 1.0f));
+
+    std::vector<float> positions;
+    queue.Drain([&](Event& event) {
+        const float x = static_cast<MouseMovedEvent&>(event).GetX();
+        positions.push_back(x);
+        if (x == 1.0f)
+            queue.Push(MouseMovedEvent(2.0f, 2.0f));
+    });
+
+    REQUIRE(positions == std::vector<float>{1.0f, 2.0f});
+}
+
+} // namespace Hazel
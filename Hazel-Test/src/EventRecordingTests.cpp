@@ -0,0 +1,101 @@
+#include "catch.hpp"
+
+#include "Hazel/Core/KeyCodes.h"
+#include "Hazel/Events/ApplicationEvent.h"
+#include "Hazel/Events/EventRecording.h"
+#include "Hazel/Events/KeyEvent.h"
+#include "Hazel/Events/MouseEvent.h"
+
+#include <cstdio>
+#include <vector>
+
+namespace Hazel
+{
+
+static const char* s_RecordingPath = "HazelTest-Input.hzev";
+
+TEST_CASE("EventPacket round-trips window, keyboard and mouse events", "[EventRecording]")
+{
+    EventPacket packet;
+    REQUIRE(EncodeEvent(KeyPressedEvent(HZ_KEY_W, 3), 7, packet));
+    REQUIRE(packet.Frame == 7);
+
+    bool decoded = false;
+    REQUIRE(DecodeEvent(packet, [&](Event& event) {
+        REQUIRE(event.GetEventType() == EventType::KeyPressed);
+        REQUIRE(static_cast<KeyPressedEvent&>(event).GetKeyCode() == HZ_KEY_W);
+        REQUIRE(static_cast<KeyPressedEvent&>(event).GetRepeatCount() == 3);
+        decoded = true;
+    }));
+    REQUIRE(decoded);
+
+    REQUIRE(EncodeEvent(MouseScrolledEvent(0.5f, -2.0f), 0, packet));
+    REQUIRE(DecodeEvent(packet, [](Event& event) {
+        REQUIRE(event.GetEventType() == EventType::MouseScrolled);
+        REQUIRE(static_cast<MouseScrolledEvent&>(event).GetXOffset() == 0.5f);
+        REQUIRE(static_cast<MouseScrolledEvent&>(event).GetYOffset() == -2.0f);
+    }));
+
+    REQUIRE(EncodeEvent(WindowResizeEvent(1280, 720), 0, packet));
+    REQUIRE(DecodeEvent(packet, [](Event& event) {
+        REQUIRE(event.GetEventType() == EventType::WindowResize);
+        REQUIRE(static_cast<WindowResizeEvent&>(event).GetWidth() == 1280);
+        REQUIRE(static_cast<WindowResizeEvent&>(event).GetHeight() == 720);
+    }));
+
+    REQUIRE(EncodeEvent(WindowLostFocusEvent(), 0, packet));
+    REQUIRE(DecodeEvent(packet, [](Event& event) { REQUIRE(event.GetEventType() == EventType::WindowLostFocus); }));
+
+    REQUIRE_FALSE(EncodeEvent(AppTickEvent(), 0, packet));
+}
+
+TEST_CASE("EventPlayer replays a recording frame by frame", "[EventRecording]")
+{
+    {
+        EventRecorder recorder;
+        REQUIRE(recorder.Open(s_RecordingPath, 1.0f / 120.0f));
+        REQUIRE(recorder.Record(KeyPressedEvent(HZ_KEY_A, 0), 0));
+        REQUIRE(recorder.Record(MouseMovedEvent(10.0f, 20.0f), 0));
+        REQUIRE_FALSE(recorder.Record(WindowCloseEvent(), 1));
+        REQUIRE(recorder.Record(KeyReleasedEvent(HZ_KEY_A), 2));
+        recorder.Close(4);
+    }
+
+    EventPlayer player;
+    REQUIRE(player.Open(s_RecordingPath));
+    REQUIRE(player.GetTimestep() == 1.0f / 120.0f);
+    REQUIRE(player.GetFrameCount() == 4);
+
+    std::vector<EventType> replayed;
+    auto collect = [&](Event& event) { replayed.push_back(event.GetEventType()); };
+
+    player.Replay(0, collect);
+    REQUIRE(replayed == std::vector<EventType>{EventType::KeyPressed, EventType::MouseMoved});
+
+    player.Replay(1, collect);
+    REQUIRE(replayed.size() == 2);
+
+    player.Replay(2, collect);
+    REQUIRE(replayed.back() == EventType::KeyReleased);
+
+    REQUIRE_FALSE(player.IsFinished(3));
+    REQUIRE(player.IsFinished(4));
+
+    std::remove(s_RecordingPath);
+}
+
+TEST_CASE("EventPlayer rejects files that are not recordings", "[EventRecording]")
+{
+    std::FILE* file = std::fopen(s_RecordingPath, "wb");
+    REQUIRE(file);
+    std::fputs("not a recording", file);
+    std::fclose(file);
+
+    EventPlayer player;
+    REQUIRE_FALSE(player.Open(s_RecordingPath));
+    REQUIRE_FALSE(player.Open("HazelTest-Missing.hzev"));
+
+    std::remove(s_RecordingPath);
+}
+
+} // namespace Hazel
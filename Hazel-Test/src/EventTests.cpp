@@ -1,9 +1,12 @@
 #include "catch.hpp"
 
+#include "Hazel/Core/Core.h"
+#include "Hazel/Core/Layer.h"
 #include "Hazel/Events/ApplicationEvent.h"
 #include "Hazel/Events/KeyEvent.h"
 #include "Hazel/Events/MouseEvent.h"
 
+#include <memory>
 #include <sstream>
 
 namespace Hazel
@@ -87,4 +90,82 @@ TEST_CASE("Event ToString and stream output include payload", "[Event]")
     stream << resizeEvent;
     REQUIRE(stream.str() == "WindowResizeEvent: 1024, 768");
 }
+
+TEST_CASE("EventDispatcher accepts callables std::function cannot hold", "[Event]")
+{
+    KeyPressedEvent event(65, 0);
+    auto keycode = std::make_unique<int>(0);
+
+    // NOTE: Move-only capture
+    auto callback = [keycode = std::move(keycode)](KeyPressedEvent& e) {
+        *keycode = e.GetKeyCode();
+        return *keycode == 65;
+    };
+
+    EventDispatcher dispatcher(event);
+    REQUIRE(dispatcher.Dispatch<KeyPressedEvent>(callback));
+    REQUIRE(event.IsHandled());
+}
+
+class ResizeListener
+{
+public:
+    virtual ~ResizeListener() = default;
+
+    bool Dispatch(Event& e)
+    {
+        EventDispatcher dispatcher(e);
+        return dispatcher.Dispatch<WindowResizeEvent>(HZ_BIND_EVENT_FN(ResizeListener::OnWindowResize));
+    }
+
+    unsigned int Width = 0;
+
+protected:
+    virtual bool OnWindowResize(WindowResizeEvent& e)
+    {
+        Width = e.GetWidth();
+        return true;
+    }
+};
+
+class HalfResizeListener : public ResizeListener
+{
+protected:
+    bool OnWindowResize(WindowResizeEvent& e) override
+    {
+        Width = e.GetWidth() / 2;
+        return true;
+    }
+};
+
+TEST_CASE("HZ_BIND_EVENT_FN binds a member function", "[Event]")
+{
+    ResizeListener listener;
+    WindowResizeEvent event(640, 480);
+
+    REQUIRE(listener.Dispatch(event));
+    REQUIRE(listener.Width == 640);
+    REQUIRE(event.IsHandled());
+
+    // NOTE: Bound through the base class, the handler still dispatches to the override
+    HalfResizeListener half;
+    WindowResizeEvent halfEvent(640, 480);
+    REQUIRE(half.Dispatch(halfEvent));
+    REQUIRE(half.Width == 320);
+}
+
+TEST_CASE("Layer subscribes to every event category by default", "[Event]")
+{
+    Layer everything;
+    Layer mouseOnly("Mouse", EventCategoryMouse);
+    MouseMovedEvent mouseEvent(1.0f, 2.0f);
+    KeyPressedEvent keyEvent(65, 0);
+
+    REQUIRE(everything.GetEventCategories() & keyEvent.GetCategoryFlags());
+    REQUIRE(mouseOnly.GetEventCategories() & mouseEvent.GetCategoryFlags());
+    REQUIRE_FALSE(mouseOnly.GetEventCategories() & keyEvent.GetCategoryFlags());
+
+    mouseOnly.SetEventCategories(EventCategoryKeyboard);
+    REQUIRE(mouseOnly.GetEventCategories() & keyEvent.GetCategoryFlags());
+}
 } // namespace Hazel
@@ -0,0 +1,66 @@
+#include "catch.hpp"
+
+#include "Hazel/Core/FramePacer.h"
+#include "Hazel/Core/Time.h"
+
+namespace Hazel
+{
+
+TEST_CASE("FramePacer uncapped measures frames without waiting", "[FramePacer]")
+{
+    FramePacer pacer;
+
+    pacer.Pace();
+    REQUIRE(pacer.GetFrameCount() == 0);
+
+    pacer.Pace();
+    pacer.Pace();
+    REQUIRE(pacer.GetFrameCount() == 2);
+    REQUIRE(pacer.GetSummary().LateFrames == 0);
+    REQUIRE(pacer.GetSummary().Jitter >= 0.0f);
+}
+
+TEST_CASE("FramePacer holds frames to the target rate", "[FramePacer]")
+{
+    FramePacer pacer(200.0);
+
+    const uint64_t start = Time::GetNanoseconds();
+    for (int i = 0; i < 5; i++)
+        pacer.Pace();
+    const uint64_t elapsed = Time::GetNanoseconds() - start;
+
+    // NOTE: Only lower bounds; a loaded machine may oversleep but the pacer must never run early
+    REQUIRE(elapsed >= 4 * 5000000ull);
+    REQUIRE(pacer.GetFrameCount() == 4);
+    REQUIRE(pacer.GetSummary().Interval >= 5.0f);
+}
+
+TEST_CASE("FramePacer keeps the average interval near the target", "[FramePacer]")
+{
+    FramePacer pacer(100.0);
+
+    for (int i = 0; i < 21; i++)
+        pacer.Pace();
+
+    // NOTE: Deadlines advance by whole periods, so an oversleep is made up on the next frame and only frames
+    // that fall a whole period behind stretch the average. The margin is for loaded CI machines.
+    REQUIRE(pacer.GetFrameCount() == 20);
+    REQUIRE(pacer.GetSummary().Interval >= 10.0f);
+    REQUIRE(pacer.GetSummary().Interval < 12.5f);
+}
+
+TEST_CASE("FramePacer restart does not measure the gap", "[FramePacer]")
+{
+    FramePacer pacer;
+
+    pacer.Pace();
+    pacer.Pace();
+    pacer.Restart();
+    pacer.Pace();
+    REQUIRE(pacer.GetFrameCount() == 1);
+
+    pacer.Pace();
+    REQUIRE(pacer.GetFrameCount() == 2);
+}
+
+} // namespace Hazel
@@ -0,0 +1,71 @@
+#include "catch.hpp"
+
+#include "hzpch.h"
+
+#include "Hazel/Core/FrameStatistics.h"
+
+namespace Hazel
+{
+
+static FrameTimings MakeFrame(float total, float update = 0.0f)
+{
+    FrameTimings timings;
+    timings.Total = total;
+    timings.Phases[static_cast<size_t>(FramePhase::Update)] = update;
+    return timings;
+}
+
+TEST_CASE("FrameStatistics reports nearest-rank percentiles", "[FrameStatistics]")
+{
+    FrameStatistics stats(100);
+    for (uint32_t i = 1; i <= 100; i++)
+        stats.AddFrame(MakeFrame((float)i, (float)i * 0.5f));
+
+    const FrameTimeSummary& summary = stats.GetSummary();
+    REQUIRE(summary.P50 == 50.0f);
+    REQUIRE(summary.P95 == 95.0f);
+    REQUIRE(summary.P99 == 99.0f);
+    REQUIRE(summary.Max == 100.0f);
+    REQUIRE(summary.Average == Approx(50.5f));
+
+    REQUIRE(stats.GetPhaseSummary(FramePhase::Update).Max == 50.0f);
+    REQUIRE(stats.GetPhaseSummary(FramePhase::Swap).Max == 0.0f);
+}
+
+TEST_CASE("FrameStatistics evicts the oldest frames from the window", "[FrameStatistics]")
+{
+    FrameStatistics stats(4, 10.0f);
+    for (uint32_t i = 0; i < 4; i++)
+        stats.AddFrame(MakeFrame(20.0f));
+    REQUIRE(stats.GetFramesOverBudget() == 4);
+    REQUIRE(stats.GetHistogram()[20] == 4);
+
+    for (uint32_t i = 0; i < 3; i++)
+        stats.AddFrame(MakeFrame(2.5f));
+
+    REQUIRE(stats.GetFrameCount() == 4);
+    REQUIRE(stats.GetTotalFrameCount() == 7);
+    REQUIRE(stats.GetFramesOverBudget() == 1);
+    REQUIRE(stats.GetTotalFramesOverBudget() == 4);
+    REQUIRE(stats.GetHistogram()[20] == 1);
+    REQUIRE(stats.GetHistogram()[2] == 3);
+    REQUIRE(stats.GetSummary().Max == 20.0f);
+    REQUIRE(stats.GetLastFrame().Total == 2.5f);
+}
+
+TEST_CASE("FrameStatistics clamps long frames into the last bucket", "[FrameStatistics]")
+{
+    FrameStatistics stats;
+    stats.AddFrame(MakeFrame(500.0f));
+    REQUIRE(stats.GetHistogram()[FrameStatistics::HistogramBucketCount - 1] == 1);
+
+    stats.SetBudget(1000.0f);
+    REQUIRE(stats.GetFramesOverBudget() == 0);
+
+    stats.Reset();
+    REQUIRE(stats.GetFrameCount() == 0);
+    REQUIRE(stats.GetSummary().Max == 0.0f);
+    REQUIRE(stats.GetLastFrame().Total == 0.0f);
+}
+
+} // namespace Hazel
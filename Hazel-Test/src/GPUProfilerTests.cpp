@@ -0,0 +1,70 @@
+#include "catch.hpp"
+
+#include "hzpch.h"
+
+#include "Hazel/Renderer/GPUProfiler.h"
+#include "Hazel/Renderer/RendererAPI.h"
+
+namespace Hazel
+{
+
+static void ProfileFrame()
+{
+    GPUProfiler::BeginFrame();
+    {
+        GPUProfileScope scene("Scene");
+        GPUProfileScope draw("Draw", 3);
+    }
+    GPUProfiler::EndFrame();
+}
+
+TEST_CASE("GPUProfiler reports nested scopes once their frame resolves", "[GPUProfiler]")
+{
+    RendererAPI::SetAPI(RendererAPI::API::None);
+    GPUProfiler::Init();
+
+    for (uint32_t i = 0; i < GPUProfiler::FrameLatency; i++)
+        ProfileFrame();
+    REQUIRE(GPUProfiler::GetResults().empty());
+
+    ProfileFrame();
+    std::vector<GPUProfileResult> results = GPUProfiler::GetResults();
+    REQUIRE(results.size() == 3);
+    REQUIRE(std::string(results[0].Name) == "Frame");
+    REQUIRE(results[0].Depth == 0);
+    REQUIRE(std::string(results[1].Name) == "Scene");
+    REQUIRE(results[1].Depth == 1);
+    REQUIRE(std::string(results[2].Name) == "Draw");
+    REQUIRE(results[2].Depth == 2);
+    REQUIRE(results[2].Index == 3);
+    REQUIRE(results[0].Milliseconds >= results[1].Milliseconds);
+    REQUIRE(GPUProfiler::GetFrameTime() == results[0].Milliseconds);
+
+    GPUProfiler::Shutdown();
+    RendererAPI::SetAPI(RendererAPI::API::OpenGL);
+}
+
+TEST_CASE("GPUProfiler ignores scopes outside a frame and when not initialized", "[GPUProfiler]")
+{
+    GPUProfiler::BeginScope("Startup");
+    GPUProfiler::EndScope();
+    REQUIRE(GPUProfiler::GetResults().empty());
+    REQUIRE_FALSE(GPUProfiler::IsDrawTimingEnabled());
+
+    RendererAPI::SetAPI(RendererAPI::API::None);
+    GPUProfiler::Init();
+
+    GPUProfiler::BeginScope("Startup");
+    GPUProfiler::EndScope();
+    for (uint32_t i = 0; i <= GPUProfiler::FrameLatency; i++)
+    {
+        GPUProfiler::BeginFrame();
+        GPUProfiler::EndFrame();
+    }
+    REQUIRE(GPUProfiler::GetResults().size() == 1);
+
+    GPUProfiler::Shutdown();
+    RendererAPI::SetAPI(RendererAPI::API::OpenGL);
+}
+
+} // namespace Hazel
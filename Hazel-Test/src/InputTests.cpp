@@ -0,0 +1,89 @@
+#include "catch.hpp"
+
+#include "Hazel/Core/Input.h"
+#include "Hazel/Events/KeyEvent.h"
+#include "Hazel/Events/MouseEvent.h"
+
+#include <thread>
+
+namespace Hazel
+{
+
+TEST_CASE("Input publishes held keys and edges once per frame", "[Input]")
+{
+    Input::Reset();
+    Input::BeginFrame();
+
+    Input::OnEvent(KeyPressedEvent(HZ_KEY_W, 0));
+    REQUIRE_FALSE(Input::IsKeyPressed(HZ_KEY_W)); // NOTE: Not published yet
+
+    Input::BeginFrame();
+    REQUIRE(Input::IsKeyPressed(HZ_KEY_W));
+    REQUIRE(Input::GetSnapshot().WasKeyPressed(HZ_KEY_W));
+
+    // NOTE: A repeat keeps the key held without another pressed edge
+    Input::OnEvent(KeyPressedEvent(HZ_KEY_W, 1));
+    Input::BeginFrame();
+    REQUIRE(Input::IsKeyPressed(HZ_KEY_W));
+    REQUIRE_FALSE(Input::GetSnapshot().WasKeyPressed(HZ_KEY_W));
+
+    Input::OnEvent(KeyReleasedEvent(HZ_KEY_W));
+    Input::BeginFrame();
+    REQUIRE_FALSE(Input::IsKeyPressed(HZ_KEY_W));
+    REQUIRE(Input::GetSnapshot().WasKeyReleased(HZ_KEY_W));
+
+    REQUIRE_FALSE(Input::IsKeyPressed(-1));
+    REQUIRE_FALSE(Input::IsKeyPressed(InputSnapshot::KeyCount));
+}
+
+TEST_CASE("Input keeps a tap shorter than a frame as both edges", "[Input]")
+{
+    Input::Reset();
+    Input::OnEvent(MouseButtonPressedEvent(HZ_MOUSE_BUTTON_LEFT));
+    Input::OnEvent(MouseButtonReleasedEvent(HZ_MOUSE_BUTTON_LEFT));
+    Input::BeginFrame();
+
+    const InputSnapshot& snapshot = Input::GetSnapshot();
+    REQUIRE_FALSE(snapshot.IsMouseButtonPressed(HZ_MOUSE_BUTTON_LEFT));
+    REQUIRE(snapshot.WasMouseButtonPressed(HZ_MOUSE_BUTTON_LEFT));
+    REQUIRE(snapshot.WasMouseButtonReleased(HZ_MOUSE_BUTTON_LEFT));
+}
+
+TEST_CASE("Input tracks the cursor and sums scrolling per frame", "[Input]")
+{
+    Input::Reset();
+    Input::OnEvent(MouseMovedEvent(10.0f, 20.0f));
+    Input::OnEvent(MouseScrolledEvent(0.0f, 1.0f));
+    Input::OnEvent(MouseScrolledEvent(0.0f, 2.0f));
+    Input::BeginFrame();
+
+    REQUIRE(Input::GetMousePosition() == std::pair<float, float>(10.0f, 20.0f));
+    REQUIRE(Input::GetSnapshot().GetScrollY() == 3.0f);
+
+    Input::BeginFrame();
+    REQUIRE(Input::GetMouseX() == 10.0f);
+    REQUIRE(Input::GetSnapshot().GetScrollY() == 0.0f);
+}
+
+TEST_CASE("Input snapshot survives the next frame's publish", "[Input]")
+{
+    Input::Reset();
+    Input::OnEvent(KeyPressedEvent(HZ_KEY_SPACE, 0));
+    Input::BeginFrame();
+    const InputSnapshot& snapshot = Input::GetSnapshot();
+    const uint64_t frame = snapshot.GetFrame();
+
+    bool workerSawKey = false;
+    std::thread worker([&snapshot, &workerSawKey]() { workerSawKey = snapshot.IsKeyPressed(HZ_KEY_SPACE); });
+
+    Input::OnEvent(KeyReleasedEvent(HZ_KEY_SPACE));
+    Input::BeginFrame();
+    worker.join();
+
+    REQUIRE(workerSawKey);
+    REQUIRE(snapshot.IsKeyPressed(HZ_KEY_SPACE));
+    REQUIRE(snapshot.GetFrame() == frame);
+    REQUIRE_FALSE(Input::IsKeyPressed(HZ_KEY_SPACE));
+}
+
+} // namespace Hazel
@@ -0,0 +1,80 @@
+#include "catch.hpp"
+
+#include "hzpch.h"
+
+#include "Hazel/Debug/Instrumentor.h"
+
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+namespace Hazel
+{
+
+static const char* s_TracePath = "HazelTest-Trace.json";
+
+static std::string ReadTrace()
+{
+    std::ifstream in(s_TracePath);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    return contents.str();
+}
+
+static size_t CountOccurrences(const std::string& text, const std::string& pattern)
+{
+    size_t count = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+        count++;
+    return count;
+}
+
+TEST_CASE("Instrumentor writes scopes from every thread as complete trace events", "[Instrumentor]")
+{
+    Instrumentor::BeginSession("Test", s_TracePath);
+    REQUIRE(Instrumentor::IsSessionActive());
+
+    {
+        InstrumentationTimer outer("Outer");
+        InstrumentationTimer inner("Inner \"quoted\"");
+    }
+    std::thread worker([]() { InstrumentationTimer timer("Worker"); });
+    worker.join();
+
+    Instrumentor::EndSession();
+    REQUIRE_FALSE(Instrumentor::IsSessionActive());
+
+    const std::string trace = ReadTrace();
+    REQUIRE(trace.rfind(R"({"otherData":{"session":"Test"},"traceEvents":[)", 0) == 0);
+    REQUIRE(trace.find("]}") != std::string::npos);
+    REQUIRE(CountOccurrences(trace, R"("ph":"X")") == 3);
+    REQUIRE(trace.find(R"("name":"Outer")") != std::string::npos);
+    REQUIRE(trace.find(R"("name":"Inner \"quoted\"")") != std::string::npos);
+
+    const size_t mainThread = trace.find(R"("name":"Outer")");
+    const size_t workerThread = trace.find(R"("name":"Worker")");
+    REQUIRE(workerThread != std::string::npos);
+    REQUIRE(trace.substr(trace.rfind("\"tid\":", mainThread), 10) !=
+            trace.substr(trace.rfind("\"tid\":", workerThread), 10));
+    REQUIRE(Instrumentor::GetDroppedEventCount() == 0);
+
+    std::remove(s_TracePath);
+}
+
+TEST_CASE("Instrumentor ignores scopes that close outside a session", "[Instrumentor]")
+{
+    {
+        InstrumentationTimer timer("BeforeSession");
+    }
+
+    Instrumentor::BeginSession("Empty", s_TracePath);
+    Instrumentor::EndSession();
+
+    const std::string trace = ReadTrace();
+    REQUIRE(trace.find("BeforeSession") == std::string::npos);
+    REQUIRE(CountOccurrences(trace, R"("ph":"X")") == 0);
+
+    std::remove(s_TracePath);
+}
+
+} // namespace Hazel
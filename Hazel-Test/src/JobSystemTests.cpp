@@ -0,0 +1,117 @@
+#include "catch.hpp"
+
+#include "Hazel/Core/JobSystem.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Hazel
+{
+
+static JobSystemSpecification WorkerSpecification(uint32_t workerCount)
+{
+    JobSystemSpecification specification;
+    specification.WorkerCount = workerCount;
+    return specification;
+}
+
+TEST_CASE("JobSystem ParallelFor visits every index exactly once", "[JobSystem]")
+{
+    JobSystem::Init(WorkerSpecification(3));
+    REQUIRE(JobSystem::GetWorkerCount() == 3);
+
+    std::vector<std::atomic<uint32_t>> visits(10007);
+    JobSystem::ParallelFor(static_cast<uint32_t>(visits.size()), 64, [&visits](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++)
+            visits[i].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    bool exactlyOnce = true;
+    for (const std::atomic<uint32_t>& count : visits)
+        exactlyOnce = exactlyOnce && count.load() == 1;
+    REQUIRE(exactlyOnce);
+
+    JobSystem::Shutdown();
+    REQUIRE_FALSE(JobSystem::IsRunning());
+}
+
+TEST_CASE("JobSystem runs dependent jobs after their counter reaches zero", "[JobSystem]")
+{
+    JobSystem::Init(WorkerSpecification(2));
+
+    std::atomic<uint32_t> firstDone{0};
+    std::atomic<bool> orderHeld{true};
+    JobCounter first;
+    JobCounter second;
+
+    for (int i = 0; i < 16; i++)
+    {
+        JobSystem::Submit(
+            [&firstDone]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                firstDone.fetch_add(1);
+            },
+            &first);
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        JobSystem::Submit(
+            [&firstDone, &orderHeld]() {
+                if (firstDone.load() != 16)
+                    orderHeld = false;
+            },
+            &second, &first);
+    }
+
+    JobSystem::Wait(second);
+    REQUIRE(first.IsDone());
+    REQUIRE(orderHeld);
+
+    JobSystem::Shutdown();
+}
+
+TEST_CASE("JobSystem jobs spread across worker threads", "[JobSystem]")
+{
+    JobSystem::Init(WorkerSpecification(4));
+
+    std::mutex mutex;
+    std::vector<std::thread::id> threads;
+    JobCounter counter;
+    for (int i = 0; i < 64; i++)
+    {
+        JobSystem::Submit(
+            [&]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                std::lock_guard<std::mutex> lock(mutex);
+                if (std::find(threads.begin(), threads.end(), std::this_thread::get_id()) == threads.end())
+                    threads.push_back(std::this_thread::get_id());
+            },
+            &counter);
+    }
+    JobSystem::Wait(counter);
+
+    REQUIRE(threads.size() > 1);
+
+    JobSystem::Shutdown();
+}
+
+TEST_CASE("JobSystem without workers runs jobs inline", "[JobSystem]")
+{
+    JobSystem::Init(WorkerSpecification(0));
+    REQUIRE_FALSE(JobSystem::IsRunning());
+
+    JobCounter first;
+    JobCounter second;
+    std::vector<int> order;
+    JobSystem::Submit([&order]() { order.push_back(1); }, &first);
+    JobSystem::Submit([&order]() { order.push_back(2); }, &second, &first);
+    JobSystem::Wait(second);
+    REQUIRE(order == std::vector<int>{1, 2});
+
+    uint32_t total = 0;
+    JobSystem::ParallelFor(100, 8, [&total](uint32_t begin, uint32_t end) { total += end - begin; });
+    REQUIRE(total == 100);
+}
+
+} // namespace Hazel
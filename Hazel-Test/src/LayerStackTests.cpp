@@ -177,4 +177,57 @@ TEST_CASE("LayerStack owns only entries still stored in the stack", "[LayerStack
     delete removedLayer;
     REQUIRE(CountingLayer::DestructorCallCount == 2);
 }
+
+TEST_CASE("LayerStack keeps layers that are not concurrent in stack order", "[LayerStack]")
+{
+    LayerStack stack;
+    Layer* l1 = new MockLayer("L1");
+    Layer* l2 = new MockLayer("L2");
+    Layer* o1 = new MockLayer("O1");
+    stack.PushLayer(l1);
+    stack.PushOverlay(o1);
+    stack.PushLayer(l2);
+
+    const std::vector<LayerUpdateWave>& waves = stack.GetUpdateWaves();
+    REQUIRE(waves.size() == 3);
+    REQUIRE(waves[0].Serial == l1);
+    REQUIRE(waves[1].Serial == l2);
+    REQUIRE(waves[2].Serial == o1);
+    for (const LayerUpdateWave& wave : waves)
+        REQUIRE(wave.Concurrent.empty());
+}
+
+TEST_CASE("LayerStack groups concurrent layers into waves by dependency", "[LayerStack]")
+{
+    LayerStack stack;
+    Layer* serial = new MockLayer("Serial");
+    Layer* physics = new MockLayer("Physics");
+    Layer* analysis = new MockLayer("Analysis");
+    Layer* afterPhysics = new MockLayer("AfterPhysics");
+    Layer* afterSerial = new MockLayer("AfterSerial");
+    physics->SetConcurrentUpdate(true);
+    analysis->SetConcurrentUpdate(true);
+    afterPhysics->SetConcurrentUpdate(true);
+    afterPhysics->AddUpdateDependency(physics);
+    afterSerial->SetConcurrentUpdate(true);
+    afterSerial->AddUpdateDependency(serial);
+
+    stack.PushLayer(serial);
+    stack.PushLayer(physics);
+    stack.PushLayer(analysis);
+    stack.PushLayer(afterPhysics);
+    stack.PushLayer(afterSerial);
+
+    const std::vector<LayerUpdateWave>& waves = stack.GetUpdateWaves();
+    REQUIRE(waves.size() == 2);
+    REQUIRE(waves[0].Serial == serial);
+    REQUIRE(waves[0].Concurrent == std::vector<Layer*>{physics, analysis});
+    REQUIRE(waves[1].Serial == nullptr);
+    REQUIRE(waves[1].Concurrent == std::vector<Layer*>{afterPhysics, afterSerial});
+
+    // NOTE: A dependency that is no longer in the stack stops counting
+    stack.PopLayer(physics);
+    REQUIRE(stack.GetUpdateWaves()[0].Concurrent == std::vector<Layer*>{analysis, afterPhysics});
+    delete physics;
+}
 } // namespace Hazel
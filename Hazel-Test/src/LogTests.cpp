@@ -0,0 +1,101 @@
+#include "catch.hpp"
+
+#include "hzpch.h"
+
+#include "Hazel/Core/AsyncLogSink.h"
+
+#include "spdlog/sinks/ostream_sink.h"
+
+#include <chrono>
+#include <thread>
+
+namespace Hazel
+{
+
+// NOTE: Takes a millisecond per message, so a small queue is guaranteed to overflow
+class SlowSink : public spdlog::sinks::base_sink<std::mutex>
+{
+public:
+    uint32_t Written = 0;
+
+protected:
+    virtual void sink_it_(const spdlog::details::log_msg& msg) override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        Written++;
+    }
+    virtual void flush_() override
+    {
+    }
+};
+
+TEST_CASE("AsyncLogSink writes messages from every thread once flushed", "[Log]")
+{
+    std::ostringstream stream;
+    auto async = std::make_shared<AsyncLogSink>(std::make_shared<spdlog::sinks::ostream_sink_mt>(stream), 64,
+                                                LogOverflowPolicy::Block);
+    spdlog::logger logger("TEST", async);
+    logger.set_pattern("%n %l %v");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&logger, t]() {
+            for (int i = 0; i < 100; i++)
+                logger.info("thread {} message {}", t, i);
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    logger.flush();
+
+    const std::string output = stream.str();
+    REQUIRE(std::count(output.begin(), output.end(), '\n') == 400);
+    REQUIRE(output.find("TEST info thread 3 message 99") != std::string::npos);
+    REQUIRE(async->GetDroppedCount() == 0);
+}
+
+TEST_CASE("AsyncLogSink drops low-severity messages when full but never errors", "[Log]")
+{
+    auto slow = std::make_shared<SlowSink>();
+    auto async = std::make_shared<AsyncLogSink>(slow, 4, LogOverflowPolicy::Drop);
+    spdlog::logger logger("TEST", async);
+
+    for (int i = 0; i < 50; i++)
+        logger.info("message {}", i);
+    logger.error("this one must arrive");
+    logger.flush();
+
+    REQUIRE(async->GetDroppedCount() > 0);
+    REQUIRE(slow->Written + async->GetDroppedCount() == 51);
+}
+
+TEST_CASE("AsyncLogSink truncates long payloads", "[Log]")
+{
+    std::ostringstream stream;
+    auto async = std::make_shared<AsyncLogSink>(std::make_shared<spdlog::sinks::ostream_sink_mt>(stream));
+    spdlog::logger logger("TEST", async);
+    logger.set_pattern("%v");
+
+    logger.warn(std::string(1000, 'x'));
+    logger.flush();
+
+    REQUIRE(stream.str().size() == AsyncLogSink::MaxPayloadSize + 1); // NOTE: Plus the newline
+}
+
+TEST_CASE("AsyncLogSink writes queued messages after their logger is gone", "[Log]")
+{
+    std::ostringstream stream;
+    auto async = std::make_shared<AsyncLogSink>(std::make_shared<spdlog::sinks::ostream_sink_mt>(stream));
+    async->set_pattern("%n %v");
+
+    {
+        spdlog::logger logger(std::string("DROPPED"), async);
+        logger.warn("queued");
+    }
+    async->flush();
+
+    REQUIRE(stream.str() == "DROPPED queued\n");
+}
+
+} // namespace Hazel
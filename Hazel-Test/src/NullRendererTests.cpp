@@ -0,0 +1,211 @@
+#include "catch.hpp"
+
+#include "hzpch.h"
+
+#include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/Renderer2D.h"
+#include "Hazel/Core/Time.h"
+#include "Platform/Null/NullRecorder.h"
+#include "Platform/Null/NullWindow.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace Hazel
+{
+
+// NOTE: Brings the renderer up on the null backend for one test and restores the default API afterwards
+struct HeadlessRendererScope
+{
+    HeadlessRendererScope()
+    {
+        RendererAPI::SetAPI(RendererAPI::API::None);
+        Renderer::Init();
+        NullRecorder::ResetStatistics();
+    }
+    ~HeadlessRendererScope()
+    {
+        Renderer::Shutdown();
+        NullRecorder::SetLogging(false);
+        NullRecorder::ClearLog();
+        RendererAPI::SetAPI(RendererAPI::API::OpenGL);
+    }
+};
+
+TEST_CASE("NullRecorder counts binds only when they change the bound object", "[NullRenderer]")
+{
+    NullRecorder::ResetStatistics();
+
+    NullRecorder::Record(NullRecorder::CommandType::BindShader, 1);
+    NullRecorder::Record(NullRecorder::CommandType::BindShader, 1);
+    NullRecorder::Record(NullRecorder::CommandType::BindTexture, 0, 7);
+    NullRecorder::Record(NullRecorder::CommandType::BindTexture, 1, 7);
+    NullRecorder::Record(NullRecorder::CommandType::BindShader, 2);
+    NullRecorder::Record(NullRecorder::CommandType::UploadBuffer, 3, 256);
+    NullRecorder::Record(NullRecorder::CommandType::Draw, 6, 10);
+
+    NullRecorder::Statistics stats = NullRecorder::GetStatistics();
+    REQUIRE(stats.Commands == 7);
+    REQUIRE(stats.StateChanges == 4);
+    REQUIRE(stats.BytesUploaded == 256);
+    REQUIRE(stats.DrawCalls == 1);
+    REQUIRE(stats.Indices == 60);
+    REQUIRE(stats.Instances == 10);
+}
+
+TEST_CASE("NullRecorder log round-trips through text and replays to the same statistics", "[NullRenderer]")
+{
+    NullRecorder::ResetStatistics();
+    NullRecorder::ClearLog();
+    NullRecorder::SetLogging(true);
+
+    NullRecorder::Record(NullRecorder::CommandType::SetViewport, 0, 0, 1280, 720);
+    NullRecorder::Record(NullRecorder::CommandType::BindVertexArray, 4);
+    NullRecorder::Record(NullRecorder::CommandType::BindVertexArray, 4);
+    NullRecorder::Record(NullRecorder::CommandType::SetUniform, 0xDEADBEEF, 64);
+    NullRecorder::Record(NullRecorder::CommandType::Draw, 36, 1, 8);
+
+    NullRecorder::SetLogging(false);
+
+    std::stringstream stream;
+    NullRecorder::WriteLog(stream, NullRecorder::GetLog());
+
+    std::vector<NullRecorder::Command> commands;
+    REQUIRE(NullRecorder::ReadLog(stream, commands));
+    REQUIRE(commands.size() == 5);
+    REQUIRE(commands[4].Type == NullRecorder::CommandType::Draw);
+    REQUIRE(commands[4].Arguments[2] == 8);
+
+    NullRecorder::Statistics recorded = NullRecorder::GetStatistics();
+    NullRecorder::Statistics replayed = NullRecorder::Replay(commands);
+    REQUIRE(replayed.Commands == recorded.Commands);
+    REQUIRE(replayed.StateChanges == recorded.StateChanges);
+    REQUIRE(replayed.UniformUploads == recorded.UniformUploads);
+    REQUIRE(replayed.BytesUploaded == recorded.BytesUploaded);
+    REQUIRE(replayed.DrawCalls == recorded.DrawCalls);
+
+    NullRecorder::ClearLog();
+    std::stringstream corrupt("Draw 1 2\nNotACommand 0 0 0 0\n");
+    commands.clear();
+    REQUIRE_FALSE(NullRecorder::ReadLog(corrupt, commands));
+}
+
+TEST_CASE("Renderer2D runs headless and batches quads into one draw", "[NullRenderer]")
+{
+    HeadlessRendererScope headless;
+
+    OrthographicCamera camera(-1.0f, 1.0f, -1.0f, 1.0f);
+    Renderer2D::BeginScene(camera);
+    for (int i = 0; i < 100; i++)
+        Renderer2D::DrawQuad(glm::vec2(i * 0.1f, 0.0f), {0.1f, 0.1f}, glm::vec4(1.0f));
+    Renderer2D::EndScene();
+
+    NullRecorder::Statistics stats = NullRecorder::GetStatistics();
+    REQUIRE(stats.DrawCalls == 1);
+    REQUIRE(stats.Indices == 600);
+    REQUIRE(stats.BytesUploaded > 0);
+}
+
+TEST_CASE("Renderer submissions sharing a shader bind it once on the null backend", "[NullRenderer]")
+{
+    HeadlessRendererScope headless;
+
+    Ref<Shader> shader = Shader::Create("Flat", "", "");
+    Ref<VertexArray> vertexArray = VertexArray::Create();
+    uint32_t indices[6] = {0, 1, 2, 2, 3, 0};
+    vertexArray->SetIndexBuffer(IndexBuffer::Create(indices, 6));
+
+    OrthographicCamera camera(-1.0f, 1.0f, -1.0f, 1.0f);
+    Renderer::BeginScene(camera);
+    NullRecorder::ResetStatistics();
+    for (int i = 0; i < 3; i++)
+        Renderer::Submit(shader, vertexArray, nullptr);
+    Renderer::SubmitInstanced(shader, vertexArray, 50);
+    Renderer::EndScene();
+
+    NullRecorder::Statistics stats = NullRecorder::GetStatistics();
+    REQUIRE(stats.DrawCalls == 4);
+    REQUIRE(stats.Instances == 53);
+    REQUIRE(stats.UniformUploads == 4);
+    REQUIRE(stats.StateChanges == 2); // NOTE: One shader and one vertex array bind
+}
+
+TEST_CASE("Renderer::GetStats counts requested draws, binds and uploads since BeginScene", "[NullRenderer]")
+{
+    HeadlessRendererScope headless;
+
+    Ref<Shader> shader = Shader::Create("Flat", "", "");
+    Ref<VertexArray> vertexArray = VertexArray::Create();
+    uint32_t indices[6] = {0, 1, 2, 2, 3, 0};
+    vertexArray->SetIndexBuffer(IndexBuffer::Create(indices, 6));
+    Ref<Texture2D> texture = Texture2D::Create(2, 2);
+
+    OrthographicCamera camera(-1.0f, 1.0f, -1.0f, 1.0f);
+    Renderer::BeginScene(camera);
+    Renderer::Submit(shader, vertexArray, texture);
+    Renderer::SubmitInstanced(shader, vertexArray, 10);
+    uint32_t pixels[4] = {};
+    texture->SetData(pixels, sizeof(pixels));
+    Renderer::EndScene();
+
+    RenderStatistics stats = Renderer::GetStats();
+    REQUIRE(stats.DrawCalls == 2);
+    REQUIRE(stats.Instances == 11);
+    REQUIRE(stats.Indices == 66);
+    REQUIRE(stats.ShaderBinds == 1);
+    REQUIRE(stats.TextureBinds == 1);
+    REQUIRE(stats.VertexArrayBinds == 1);
+    REQUIRE(stats.TextureBytesUploaded == sizeof(pixels));
+    REQUIRE(stats.BufferBytesUploaded >= 208); // NOTE: At least the SceneData uniform block
+
+    Renderer::BeginScene(camera);
+    REQUIRE(Renderer::GetStats().DrawCalls == 0);
+    Renderer::EndScene();
+}
+
+TEST_CASE("Null file textures count the bytes of their own channel count", "[NullRenderer]")
+{
+    HeadlessRendererScope headless;
+
+    // NOTE: A 2x3 binary PPM, which stb_image reports as three channels
+    const std::string path = "NullTextureTest.ppm";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "P6\n2 3\n255\n" << std::string(2 * 3 * 3, '\x7f');
+    }
+
+    OrthographicCamera camera(-1.0f, 1.0f, -1.0f, 1.0f);
+    Renderer::BeginScene(camera);
+    Ref<Texture2D> texture = Texture2D::Create(path);
+    Renderer::EndScene();
+    std::remove(path.c_str());
+
+    REQUIRE(texture->GetWidth() == 2);
+    REQUIRE(texture->GetHeight() == 3);
+    REQUIRE(Renderer::GetStats().TextureBytesUploaded == 2 * 3 * 3);
+}
+
+TEST_CASE("NullWindow waits out its timeout unless woken", "[NullRenderer]")
+{
+    NullWindow window(WindowProps("Headless", 64, 64));
+
+    uint64_t start = Time::GetNanoseconds();
+    window.WaitEvents(0.01);
+    REQUIRE(Time::GetNanoseconds() - start >= 10000000ull);
+
+    // NOTE: A wake that arrives before the wait still ends it
+    window.Wake();
+    start = Time::GetNanoseconds();
+    window.WaitEvents(10.0);
+    REQUIRE(Time::GetNanoseconds() - start < 5000000000ull);
+
+    std::thread waker([&window]() { window.Wake(); });
+    start = Time::GetNanoseconds();
+    window.WaitEvents(10.0);
+    waker.join();
+    REQUIRE(Time::GetNanoseconds() - start < 5000000000ull);
+}
+
+} // namespace Hazel
@@ -0,0 +1,51 @@
+#include "catch.hpp"
+
+#include "hzpch.h"
+
+#include "Hazel/Renderer/RenderCommandBuffer.h"
+
+namespace Hazel
+{
+
+TEST_CASE("RenderCommandBuffer sort key orders pass before shader, texture and vertex array", "[RenderCommandBuffer]")
+{
+    REQUIRE(RenderCommandBuffer::MakeSortKey(1, 0, 0, 0) > RenderCommandBuffer::MakeSortKey(0, 0xFFFF, 0xFFFF, 0xFFFF));
+    REQUIRE(RenderCommandBuffer::MakeSortKey(0, 2, 0, 0) > RenderCommandBuffer::MakeSortKey(0, 1, 0xFFFF, 0xFFFF));
+    REQUIRE(RenderCommandBuffer::MakeSortKey(0, 1, 2, 0) > RenderCommandBuffer::MakeSortKey(0, 1, 1, 0xFFFF));
+    REQUIRE(RenderCommandBuffer::MakeSortKey(0, 1, 1, 2) > RenderCommandBuffer::MakeSortKey(0, 1, 1, 1));
+}
+
+TEST_CASE("RenderCommandBuffer sort key packs fields into their bit ranges", "[RenderCommandBuffer]")
+{
+    REQUIRE(RenderCommandBuffer::MakeSortKey(0xAB, 0x1234, 0x5678, 0x9ABC) == 0xAB123456789ABC00ull);
+    REQUIRE(RenderCommandBuffer::MakeSortKey(0, 0x10001, 0, 0) == RenderCommandBuffer::MakeSortKey(0, 1, 0, 0));
+}
+
+TEST_CASE("RenderCommandBuffer groups commands by key and keeps submission order within a group",
+          "[RenderCommandBuffer]")
+{
+    RenderCommandBuffer buffer;
+    DrawCommand command;
+
+    const float order[] = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+    const uint64_t keys[] = {RenderCommandBuffer::MakeSortKey(0, 2, 0, 0), RenderCommandBuffer::MakeSortKey(0, 1, 0, 0),
+                             RenderCommandBuffer::MakeSortKey(0, 2, 0, 0), RenderCommandBuffer::MakeSortKey(1, 1, 0, 0),
+                             RenderCommandBuffer::MakeSortKey(0, 1, 0, 0)};
+    for (int i = 0; i < 5; i++)
+    {
+        command.Transform = glm::mat4(order[i]);
+        buffer.Submit(keys[i], command);
+    }
+
+    REQUIRE(buffer.GetCount() == 5);
+    buffer.Sort();
+
+    const float expected[] = {1.0f, 4.0f, 0.0f, 2.0f, 3.0f};
+    for (uint32_t i = 0; i < 5; i++)
+        REQUIRE(buffer[i].Transform[0][0] == expected[i]);
+
+    buffer.Clear();
+    REQUIRE(buffer.IsEmpty());
+}
+
+} // namespace Hazel
@@ -0,0 +1,127 @@
+#include "catch.hpp"
+
+#include "hzpch.h"
+
+#include "Hazel/Renderer/GraphicsContext.h"
+#include "Hazel/Renderer/RenderCommandQueue.h"
+#include "Hazel/Renderer/RenderThread.h"
+
+#include <thread>
+
+namespace Hazel
+{
+
+namespace
+{
+class TestContext : public GraphicsContext
+{
+public:
+    virtual void Init() override
+    {
+    }
+    virtual void SwapBuffers() override
+    {
+    }
+    virtual void MakeCurrent() override
+    {
+        Owner = std::this_thread::get_id();
+    }
+    virtual void ReleaseCurrent() override
+    {
+        Released = true;
+    }
+
+    std::thread::id Owner;
+    bool Released = false;
+};
+} // namespace
+
+TEST_CASE("RenderCommandQueue executes commands in submission order", "[RenderThread]")
+{
+    struct Payload
+    {
+        std::vector<int>* Order;
+        int Value;
+    };
+
+    RenderCommandQueue queue;
+    std::vector<int> order;
+
+    for (int i = 0; i < 3; i++)
+    {
+        void* storage = queue.Allocate(
+            [](void* data) {
+                Payload* payload = static_cast<Payload*>(data);
+                payload->Order->push_back(payload->Value);
+            },
+            sizeof(Payload));
+        *static_cast<Payload*>(storage) = {&order, i};
+    }
+
+    REQUIRE(queue.GetCommandCount() == 3);
+    queue.Execute();
+    REQUIRE(order == std::vector<int>{0, 1, 2});
+    REQUIRE(queue.GetCommandCount() == 0);
+}
+
+TEST_CASE("RenderCommandQueue keeps data aligned across chunks", "[RenderThread]")
+{
+    RenderCommandQueue queue;
+
+    void* small = queue.AllocateData(3);
+    void* large = queue.AllocateData(RenderCommandQueue::ChunkSize * 2);
+    void* next = queue.AllocateData(8);
+
+    REQUIRE(reinterpret_cast<uintptr_t>(small) % RenderCommandQueue::Alignment == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(large) % RenderCommandQueue::Alignment == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(next) % RenderCommandQueue::Alignment == 0);
+    queue.Execute();
+}
+
+TEST_CASE("RenderThread executes inline when not running", "[RenderThread]")
+{
+    REQUIRE_FALSE(RenderThread::IsRunning());
+
+    int value = 0;
+    RenderThread::Submit([&value]() { value = 42; });
+    REQUIRE(value == 42);
+
+    int data = 7;
+    REQUIRE(RenderThread::CopyFrameData(&data, sizeof(int)) == &data);
+}
+
+TEST_CASE("RenderThread runs recorded frames on the context thread", "[RenderThread]")
+{
+    TestContext context;
+    RenderThread::Start(&context);
+    REQUIRE(RenderThread::IsRecording());
+
+    std::vector<int> executed;
+    std::thread::id executingThread;
+    for (int frame = 0; frame < 4; frame++)
+    {
+        int copied = frame * 10;
+        const int* frameData = static_cast<const int*>(RenderThread::CopyFrameData(&copied, sizeof(int)));
+        copied = -1;
+
+        RenderThread::Submit([&executed, &executingThread, frameData]() {
+            executed.push_back(*frameData);
+            executingThread = std::this_thread::get_id();
+        });
+        RenderThread::NextFrame();
+    }
+
+    int created = 0;
+    RenderThread::SubmitAndWait([&created]() { created = 1; });
+    REQUIRE(created == 1);
+
+    RenderThread::Stop();
+    REQUIRE_FALSE(RenderThread::IsRunning());
+    REQUIRE(context.Released);
+
+    REQUIRE(executed == std::vector<int>{0, 10, 20, 30});
+    REQUIRE(executingThread == context.Owner);
+    REQUIRE(executingThread != std::this_thread::get_id());
+}
+
+} // namespace Hazel
@@ -0,0 +1,32 @@
+#include "catch.hpp"
+
+#include "hzpch.h"
+
+#include "Hazel/Renderer/Shader.h"
+
+namespace Hazel
+{
+
+TEST_CASE("ShaderUniform hashes names with FNV-1a", "[Shader]")
+{
+    REQUIRE(ShaderUniform("").Hash == 2166136261u);
+    REQUIRE(ShaderUniform("a").Hash == 0xe40c292cu);
+    REQUIRE(ShaderUniform("foobar").Hash == 0xbf9cf968u);
+}
+
+TEST_CASE("ShaderUniform hash is available at compile time", "[Shader]")
+{
+    static constexpr ShaderUniform viewProjection("u_ViewProjection");
+    static_assert(viewProjection.Hash == ShaderUniform::HashName("u_ViewProjection"), "Hash must be constexpr");
+
+    REQUIRE(viewProjection == ShaderUniform(std::string("u_ViewProjection")));
+    REQUIRE(viewProjection == ShaderUniform(std::string_view("u_ViewProjection")));
+}
+
+TEST_CASE("ShaderUniform distinguishes different names", "[Shader]")
+{
+    REQUIRE(ShaderUniform("u_ViewProjection") != ShaderUniform("u_Transform"));
+    REQUIRE(ShaderUniform("u_Texture") != ShaderUniform("u_Textures"));
+    REQUIRE(ShaderUniform("u_Color") != ShaderUniform("u_color"));
+}
+} // namespace Hazel
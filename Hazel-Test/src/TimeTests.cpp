@@ -0,0 +1,53 @@
+#include "catch.hpp"
+
+#include "Hazel/Core/Time.h"
+
+namespace Hazel
+{
+
+static constexpr uint64_t s_Millisecond = 1000000;
+
+TEST_CASE("Time is monotonic and matches its seconds", "[Time]")
+{
+    const uint64_t first = Time::GetNanoseconds();
+    const uint64_t second = Time::GetNanoseconds();
+
+    REQUIRE(second >= first);
+    REQUIRE(Time::GetSeconds() >= static_cast<double>(second) * 1e-9);
+    REQUIRE(Time::ToTimestep(16 * s_Millisecond).GetMilliseconds() == Approx(16.0f));
+}
+
+TEST_CASE("FixedStepAccumulator carries time that does not fill a step", "[Time]")
+{
+    FixedStepAccumulator accumulator(10 * s_Millisecond);
+
+    REQUIRE(accumulator.IsEnabled());
+    REQUIRE(accumulator.Advance(4 * s_Millisecond) == 0);
+    REQUIRE(accumulator.GetAlpha() == Approx(0.4f));
+    REQUIRE(accumulator.Advance(7 * s_Millisecond) == 1);
+    REQUIRE(accumulator.GetAlpha() == Approx(0.1f));
+    REQUIRE(accumulator.Advance(25 * s_Millisecond) == 2);
+    REQUIRE(accumulator.GetAlpha() == Approx(0.6f));
+    REQUIRE(accumulator.GetStep().GetMilliseconds() == Approx(10.0f));
+}
+
+TEST_CASE("FixedStepAccumulator drops time beyond its step limit", "[Time]")
+{
+    FixedStepAccumulator accumulator(10 * s_Millisecond, 3);
+
+    REQUIRE(accumulator.Advance(105 * s_Millisecond) == 3);
+    REQUIRE(accumulator.GetAlpha() == Approx(0.5f));
+    REQUIRE(accumulator.Advance(5 * s_Millisecond) == 1);
+    REQUIRE(accumulator.GetAlpha() == Approx(0.0f));
+}
+
+TEST_CASE("FixedStepAccumulator without a step never steps", "[Time]")
+{
+    FixedStepAccumulator accumulator;
+
+    REQUIRE_FALSE(accumulator.IsEnabled());
+    REQUIRE(accumulator.Advance(1000 * s_Millisecond) == 0);
+    REQUIRE(accumulator.GetAlpha() == Approx(0.0f));
+}
+
+} // namespace Hazel
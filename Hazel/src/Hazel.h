@@ -5,8 +5,11 @@
 #include "Hazel/Core/Application.h"
 #include "Hazel/Core/Layer.h"
 #include "Hazel/Core/Log.h"
+#include "Hazel/Debug/AllocationTracker.h"
+#include "Hazel/Debug/Instrumentor.h"
 
 #include "Hazel/Core/Timestep.h"
+#include "Hazel/Core/Time.h"
 
 #include "Hazel/Core/Input.h"
 #include "Hazel/Core/KeyCodes.h"
@@ -17,7 +20,9 @@
 
 // ---Renderer---------------------
 #include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/Renderer2D.h"
 #include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/GPUProfiler.h"
 
 #include "Hazel/Renderer/Buffer.h"
 #include "Hazel/Renderer/Shader.h"
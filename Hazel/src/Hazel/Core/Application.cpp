@@ -2,86 +2,348 @@
 #include "Application.h"
 
 #include "Core.h"
+#include "Input.h"
+#include "Time.h"
 #include "Hazel/ImGui/ImGuiLayer.h"
+#include "Hazel/Renderer/GPUProfiler.h"
 #include "Hazel/Renderer/Renderer.h"
 
-#include <GLFW/glfw3.h>
+#include <chrono>
+#include <cmath>
 
 namespace Hazel
 {
 
-#define BIND_EVENT_FN(x) std::bind(&Application::x, this, std::placeholders::_1)
+#define BIND_EVENT_FN(x) HZ_BIND_EVENT_FN(Application::x)
 
 Application* Application::s_Instance = nullptr;
 
-Application::Application()
+using Clock = std::chrono::steady_clock;
+
+static float MillisecondsBetween(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+static uint64_t SecondsToNanoseconds(double seconds)
+{
+    return static_cast<uint64_t>(std::llround(seconds * 1e9));
+}
+
+// NOTE: Concurrent layers of a wave update on jobs while its serial layer updates on this thread
+template <typename F> static void UpdateLayers(LayerStack& layerStack, const F& update)
 {
+    for (const LayerUpdateWave& wave : layerStack.GetUpdateWaves())
+    {
+        JobCounter counter;
+        for (Layer* layer : wave.Concurrent)
+            JobSystem::Submit([layer, &update]() { update(layer); }, &counter);
+        if (wave.Serial)
+            update(wave.Serial);
+        JobSystem::Wait(counter);
+    }
+}
+
+Application::Application(const ApplicationSpecification& specification)
+    : m_Specification(specification),
+      m_FixedUpdates(SecondsToNanoseconds(specification.FixedUpdateTimestep), specification.MaxFixedUpdatesPerFrame),
+      m_FramePacer(specification.TargetFrameRate)
+{
+    HZ_PROFILE_FUNCTION();
+
     HZ_CORE_ASSERT(!s_Instance, "Application already exists!");
     s_Instance = this;
 
-    m_Window = Window::Create();
-    m_Window->SetEventCallback(BIND_EVENT_FN(OnEvent));
+    JobSystem::Init(m_Specification.Jobs);
+
+    if (m_Specification.Headless)
+        RendererAPI::SetAPI(RendererAPI::API::None);
+
+    WindowProps windowProps(m_Specification.Name, m_Specification.Width, m_Specification.Height);
+    windowProps.ThreadedRendering = m_Specification.ThreadedRendering && !m_Specification.Headless;
+    windowProps.Headless = m_Specification.Headless;
+    m_Window = Window::Create(windowProps);
+    m_EventQueue.SetCoalescing(m_Specification.CoalesceEvents);
+    m_Window->SetEventCallback(BIND_EVENT_FN(OnWindowEvent));
+
+    if (!m_Specification.ReplayInputPath.empty())
+    {
+        m_EventPlayer = std::make_unique<EventPlayer>();
+        if (m_EventPlayer->Open(m_Specification.ReplayInputPath))
+        {
+            HZ_CORE_INFO("Replaying {0} frames of input from {1}", m_EventPlayer->GetFrameCount(),
+                         m_Specification.ReplayInputPath);
+            m_FrameStepNanoseconds = SecondsToNanoseconds(m_EventPlayer->GetTimestep());
+            Input::Reset();
+        }
+        else
+        {
+            HZ_CORE_ERROR("Could not read input recording {0}", m_Specification.ReplayInputPath);
+            m_EventPlayer.reset();
+        }
+    }
+    else if (!m_Specification.RecordInputPath.empty())
+    {
+        if (m_EventRecorder.Open(m_Specification.RecordInputPath, m_Specification.FixedTimestep))
+        {
+            HZ_CORE_INFO("Recording input to {0}", m_Specification.RecordInputPath);
+            m_FrameStepNanoseconds = SecondsToNanoseconds(m_Specification.FixedTimestep);
+        }
+        else
+            HZ_CORE_ERROR("Could not open {0} for recording input", m_Specification.RecordInputPath);
+    }
 
     Renderer::Init();
+    Renderer::OnWindowResize(m_Window->GetWidth(), m_Window->GetHeight());
 
-    m_ImGuiLayer = new ImGuiLayer();
-    PushOverlay(m_ImGuiLayer);
+    if (!m_Specification.Headless)
+    {
+        m_ImGuiLayer = new ImGuiLayer();
+        PushOverlay(m_ImGuiLayer);
+    }
 }
 
 Application::~Application()
 {
+    HZ_PROFILE_FUNCTION();
+
+    m_EventRecorder.Close(m_FrameIndex);
+
+    Renderer::Shutdown();
+    JobSystem::Shutdown();
+    s_Instance = nullptr;
 }
 
 void Application::PushLayer(Layer* layer)
 {
+    HZ_PROFILE_FUNCTION();
+
     m_LayerStack.PushLayer(layer);
     layer->OnAttach();
 }
 
 void Application::PushOverlay(Layer* layer)
 {
+    HZ_PROFILE_FUNCTION();
+
     m_LayerStack.PushOverlay(layer);
     layer->OnAttach();
 }
 
 void Application::OnEvent(Event& e)
 {
+    HZ_PROFILE_FUNCTION();
+    HZ_MEMORY_SCOPE("Events");
+
+    Input::OnEvent(e);
+
     EventDispatcher dispatcher(e);
     dispatcher.Dispatch<WindowCloseEvent>(BIND_EVENT_FN(OnWindowClose));
     dispatcher.Dispatch<WindowResizeEvent>(BIND_EVENT_FN(OnWindowResize));
+    dispatcher.Dispatch<WindowFocusEvent>(BIND_EVENT_FN(OnWindowFocus));
+    dispatcher.Dispatch<WindowLostFocusEvent>(BIND_EVENT_FN(OnWindowLostFocus));
 
+    const int categories = e.GetCategoryFlags();
     for (auto it = m_LayerStack.end(); it != m_LayerStack.begin();)
     {
-        (*--it)->OnEvent(e);
+        Layer* layer = *--it;
+        if (!(layer->GetEventCategories() & categories))
+            continue;
+
+        layer->OnEvent(e);
         if (e.IsHandled())
             break;
     }
 }
 
+void Application::OnWindowEvent(Event& e)
+{
+    // NOTE: A replay owns the input; the window's own events (close, resize) still go through
+    if (m_EventPlayer && e.IsInCategory(EventCategoryInput))
+        return;
+
+    m_EventQueue.Push(e);
+}
+
 void Application::Run()
 {
+    HZ_PROFILE_FUNCTION();
+
+    m_LastFrameNanoseconds = Time::GetNanoseconds();
+    // NOTE: The first frame, and the one after it that ImGui needs to settle its layout
+    RequestFrames(2);
+
     while (m_Running)
     {
-        float time = static_cast<float>(glfwGetTime()); // TODO: Platform::GetTime()
-        Timestep timestep = time - m_LastFrameTime;
-        m_LastFrameTime = time;
+        // NOTE: With nothing to show, block in the window until an event or a frame request wakes it. Like the
+        // minimized wait, the time spent here is not frame time.
+        if (m_Specification.RenderOnDemand && !m_EventPlayer && !m_Minimized && !ConsumeFrameRequest())
+        {
+            HZ_PROFILE_SCOPE("Wait for frame request");
+
+            // NOTE: Checked again once requesters can see the flag; see RequestFrames
+            m_WaitingForFrames.store(true);
+            const bool requested = ConsumeFrameRequest();
+            if (!requested)
+                m_Window->WaitEvents(m_Specification.OnDemandWaitTimeout);
+            m_WaitingForFrames.store(false);
+
+            if (!requested)
+            {
+                m_FramePacer.Restart();
+                m_LastFrameNanoseconds = Time::GetNanoseconds();
+                continue;
+            }
+        }
+
+        HZ_PROFILE_SCOPE("RunLoop");
+
+        const Clock::time_point frameStart = Clock::now();
+        AllocationTracker::BeginFrame();
+
+        {
+            HZ_PROFILE_SCOPE("Dispatch events");
 
-        if (!m_Minimized)
+            // NOTE: UI reacting to input (hover, layout) shows up a frame after it, so input buys one more
+            if (m_Specification.RenderOnDemand && m_EventQueue.GetSize() > 0)
+                RequestFrames(1);
+
+            m_EventQueue.Drain([this](Event& e) {
+                m_EventRecorder.Record(e, m_FrameIndex);
+                OnEvent(e);
+            });
+
+            if (m_EventPlayer)
+            {
+                if (m_EventPlayer->IsFinished(m_FrameIndex))
+                    break;
+                m_EventPlayer->Replay(m_FrameIndex, BIND_EVENT_FN(OnEvent));
+            }
+
+            Input::BeginFrame();
+        }
+        if (!m_Running)
+            break;
+
+        if (m_Minimized)
         {
+            // NOTE: Nothing is visible, so skip the frame and sleep in the OS until the window has news; the
+            // timeout bounds how long a Close from another thread goes unnoticed. The wait is not frame time.
+            m_Window->WaitEvents(m_Specification.MinimizedWaitTimeout);
+            m_FramePacer.Restart();
+            m_LastFrameNanoseconds = Time::GetNanoseconds();
+            continue;
+        }
+
+        // NOTE: Subtracted in integer nanoseconds; a float clock quantizes deltas after hours of uptime
+        const uint64_t now = Time::GetNanoseconds();
+        uint64_t elapsed = now - m_LastFrameNanoseconds;
+        m_LastFrameNanoseconds = now;
+        double time = static_cast<double>(now) * 1e-9;
+
+        // NOTE: Recording and replay step a fixed clock so both runs simulate the same frames
+        if (m_FrameStepNanoseconds)
+        {
+            elapsed = m_FrameStepNanoseconds;
+            time = static_cast<double>(m_FrameIndex) * static_cast<double>(m_FrameStepNanoseconds) * 1e-9;
+        }
+        const Timestep timestep = Time::ToTimestep(elapsed);
+        Renderer::SetTime(static_cast<float>(time));
+
+        GPUProfiler::BeginFrame();
+
+        {
+            HZ_PROFILE_SCOPE("LayerStack OnUpdate");
+            HZ_MEMORY_SCOPE("Update");
+
+            const uint32_t fixedUpdates = m_FixedUpdates.Advance(elapsed);
+            const Timestep fixedTimestep = m_FixedUpdates.GetStep();
+            for (uint32_t i = 0; i < fixedUpdates; i++)
+                UpdateLayers(m_LayerStack, [fixedTimestep](Layer* layer) { layer->OnFixedUpdate(fixedTimestep); });
+
+            UpdateLayers(m_LayerStack, [timestep](Layer* layer) { layer->OnUpdate(timestep); });
+        }
+        const Clock::time_point updateEnd = Clock::now();
+
+        {
+            HZ_PROFILE_SCOPE("LayerStack OnRender");
+            HZ_MEMORY_SCOPE("Render");
+
+            for (Layer* layer : m_LayerStack)
+                layer->OnRender();
+        }
+        const Clock::time_point renderEnd = Clock::now();
+
+        // NOTE: With ThreadedRendering the GL work recorded here runs on the render thread while the next
+        // frame is simulated; see RenderThread
+        if (m_ImGuiLayer)
+        {
+            HZ_PROFILE_SCOPE("LayerStack OnImGuiRender");
+            HZ_MEMORY_SCOPE("ImGui");
+
+            m_ImGuiLayer->Begin();
             for (Layer* layer : m_LayerStack)
-                layer->OnUpdate(timestep);
+                layer->OnImGuiRender();
+            m_ImGuiLayer->End();
         }
 
-        // TODO: you need to use another thread
-        m_ImGuiLayer->Begin();
-        for (Layer* layer : m_LayerStack)
-            layer->OnImGuiRender();
-        m_ImGuiLayer->End();
+        GPUProfiler::EndFrame();
+        const Clock::time_point imGuiEnd = Clock::now();
 
-        m_Window->OnUpdate();
+        {
+            HZ_MEMORY_SCOPE("Window");
+            m_Window->OnUpdate();
+        }
+        const Clock::time_point frameEnd = Clock::now();
+
+        FrameTimings timings;
+        timings.Total = MillisecondsBetween(frameStart, frameEnd);
+        timings.Phases[static_cast<size_t>(FramePhase::Update)] = MillisecondsBetween(frameStart, updateEnd);
+        timings.Phases[static_cast<size_t>(FramePhase::Render)] = MillisecondsBetween(updateEnd, renderEnd);
+        timings.Phases[static_cast<size_t>(FramePhase::ImGui)] = MillisecondsBetween(renderEnd, imGuiEnd);
+        timings.Phases[static_cast<size_t>(FramePhase::Swap)] = MillisecondsBetween(imGuiEnd, frameEnd);
+        m_FrameStatistics.AddFrame(timings);
+        m_FrameIndex++;
+
+        // NOTE: Replays run as fast as they can; their clock does not depend on frame rate
+        if (!m_EventPlayer)
+            m_FramePacer.Pace();
     }
 }
 
+void Application::Close()
+{
+    m_Running = false;
+    m_Window->Wake();
+}
+
+void Application::RequestFrames(uint32_t count)
+{
+    uint32_t requested = m_RequestedFrames.load(std::memory_order_relaxed);
+    while (requested < count && !m_RequestedFrames.compare_exchange_weak(requested, count))
+        ;
+
+    // NOTE: Only a request that ends an idle wait has to interrupt it; requests made during a frame, such as an
+    // animation's, cost no wakeup. Both sides are sequentially consistent: either the loop sees this request
+    // when it checks again after raising the flag, or this sees the flag and wakes the wait.
+    if (requested == 0 && count > 0 && m_WaitingForFrames.load())
+        m_Window->Wake();
+}
+
+bool Application::ConsumeFrameRequest()
+{
+    if (m_EventQueue.GetSize() > 0)
+        return true;
+
+    // NOTE: Sequentially consistent, not relaxed: with no request pending this load is the only access, and
+    // the re-check in Run must not move ahead of its store to m_WaitingForFrames or a request can go unseen by
+    // both sides; see RequestFrames
+    uint32_t requested = m_RequestedFrames.load();
+    while (requested > 0 && !m_RequestedFrames.compare_exchange_weak(requested, requested - 1))
+        ;
+    return requested > 0;
+}
+
 bool Application::OnWindowClose(WindowCloseEvent& e)
 {
     m_Running = false;
@@ -102,4 +364,17 @@ bool Application::OnWindowResize(WindowResizeEvent& e)
     return false;
 }
 
+bool Application::OnWindowFocus(WindowFocusEvent& e)
+{
+    m_FramePacer.SetTargetFrameRate(m_Specification.TargetFrameRate);
+    return false;
+}
+
+bool Application::OnWindowLostFocus(WindowLostFocusEvent& e)
+{
+    if (m_Specification.BackgroundFrameRate > 0.0)
+        m_FramePacer.SetTargetFrameRate(m_Specification.BackgroundFrameRate);
+    return false;
+}
+
 } // namespace Hazel
@@ -4,22 +4,87 @@
 
 #include "Hazel/Events/ApplicationEvent.h"
 #include "Hazel/Events/Event.h"
+#include "Hazel/Events/EventQueue.h"
+#include "Hazel/Events/EventRecording.h"
+#include "Hazel/Core/FramePacer.h"
+#include "Hazel/Core/FrameStatistics.h"
+#include "Hazel/Core/JobSystem.h"
 #include "Hazel/Core/LayerStack.h"
 
+#include "Hazel/Core/Time.h"
 #include "Hazel/Core/Timestep.h"
 
 #include "Hazel/ImGui/ImGuiLayer.h"
 
+#include <atomic>
+
 namespace Hazel
 {
 
+struct ApplicationSpecification
+{
+    std::string Name = "Hazel Engine";
+    uint32_t Width = 1600;
+    uint32_t Height = 900;
+
+    // NOTE: Opt-in. All GL work moves to a render thread that executes frame N while the main thread
+    // records frame N+1. ImGui platform windows (multi-viewport) are unavailable in this mode.
+    bool ThreadedRendering = false;
+
+    // NOTE: Runs without a window, GL context or ImGui on the null renderer backend (RendererAPI::API::None).
+    // Draws are only counted; see NullRecorder. Meant for benchmarks and CI machines without a display.
+    bool Headless = false;
+
+    // NOTE: Either one switches the clock to fixed steps of FixedTimestep seconds per frame. Recording writes
+    // every keyboard and mouse event with its frame index; replay feeds a recording back through OnEvent (live
+    // input is ignored, so Input reflects only the recording) and closes the application after its last frame.
+    // Replays use the timestep stored in the recording.
+    std::string RecordInputPath;
+    std::string ReplayInputPath;
+    float FixedTimestep = 1.0f / 60.0f;
+
+    // NOTE: Window events are queued and dispatched once at the start of the next frame. With this on,
+    // back-to-back mouse moves, scrolls and resizes are folded into one event; see EventQueue.
+    bool CoalesceEvents = true;
+
+    // NOTE: Seconds between Layer::OnFixedUpdate calls; zero turns fixed updates off. Frame time is accumulated
+    // and spent in whole steps before OnUpdate, at most MaxFixedUpdatesPerFrame of them per frame.
+    double FixedUpdateTimestep = 0.0;
+    uint32_t MaxFixedUpdatesPerFrame = 8;
+
+    // NOTE: Frames per second the loop is held to, on top of VSync; zero leaves pacing to VSync. While the
+    // window has no focus BackgroundFrameRate applies instead, unless it is zero. A minimized window draws
+    // nothing and blocks on window events, waking at least every MinimizedWaitTimeout seconds.
+    double TargetFrameRate = 0.0;
+    double BackgroundFrameRate = 15.0;
+    double MinimizedWaitTimeout = 0.25;
+
+    // NOTE: Draws a frame only when there is something new to show: queued window events, Invalidate or
+    // RequestFrames. In between the loop blocks on window events, so an idle window costs next to no CPU or GPU
+    // time while input still wakes it at once. Replays always run every frame.
+    bool RenderOnDemand = false;
+    double OnDemandWaitTimeout = 1.0;
+
+    // NOTE: Worker threads for JobSystem, started before the renderer and stopped after it
+    JobSystemSpecification Jobs;
+};
+
 class Application
 {
 public:
-    Application();
+    Application(const ApplicationSpecification& specification = ApplicationSpecification());
     virtual ~Application();
 
     void Run();
+    void Close();
+
+    // NOTE: Ask for one more frame, or at least count more, with RenderOnDemand; an animation requests a frame
+    // for as long as it runs. Safe to call from any thread.
+    inline void Invalidate()
+    {
+        RequestFrames(1);
+    }
+    void RequestFrames(uint32_t count);
 
     void OnEvent(Event& e);
 
@@ -34,18 +99,52 @@ public:
     {
         return *m_Window;
     }
+    inline const ApplicationSpecification& GetSpecification() const
+    {
+        return m_Specification;
+    }
+    inline FrameStatistics& GetFrameStatistics()
+    {
+        return m_FrameStatistics;
+    }
+    inline const FramePacer& GetFramePacer() const
+    {
+        return m_FramePacer;
+    }
+    // NOTE: How far the simulation has run into the next fixed step, in [0, 1); for interpolating rendered state
+    // between the last two fixed updates
+    inline float GetFixedUpdateAlpha() const
+    {
+        return m_FixedUpdates.GetAlpha();
+    }
 
 private:
+    void OnWindowEvent(Event& e);
+    bool ConsumeFrameRequest();
     bool OnWindowClose(WindowCloseEvent& e);
     bool OnWindowResize(WindowResizeEvent& e);
+    bool OnWindowFocus(WindowFocusEvent& e);
+    bool OnWindowLostFocus(WindowLostFocusEvent& e);
 
 private:
+    ApplicationSpecification m_Specification;
     std::unique_ptr<Window> m_Window;
-    ImGuiLayer* m_ImGuiLayer;
-    bool m_Running = true;
+    ImGuiLayer* m_ImGuiLayer = nullptr;
+    std::atomic<bool> m_Running{true}; // NOTE: Close may come from any thread
     LayerStack m_LayerStack;
-    float m_LastFrameTime = 0.0f;
+    uint64_t m_LastFrameNanoseconds = 0;
+    FixedStepAccumulator m_FixedUpdates;
+    FrameStatistics m_FrameStatistics;
+    FramePacer m_FramePacer;
     bool m_Minimized = false;
+    std::atomic<uint32_t> m_RequestedFrames{0};
+    std::atomic<bool> m_WaitingForFrames{false};
+
+    EventQueue m_EventQueue;
+    uint32_t m_FrameIndex = 0;
+    uint64_t m_FrameStepNanoseconds = 0; // NOTE: Recording or replaying; zero runs on the wall clock
+    EventRecorder m_EventRecorder;
+    std::unique_ptr<EventPlayer> m_EventPlayer;
 
 private:
     static Application* s_Instance;
@@ -0,0 +1,158 @@
+#include "hzpch.h"
+#include "AsyncLogSink.h"
+
+#include <chrono>
+#include <cstring>
+
+namespace Hazel
+{
+
+static uint32_t RoundUpToPowerOfTwo(uint32_t value)
+{
+    uint32_t result = 2;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+AsyncLogSink::AsyncLogSink(std::shared_ptr<spdlog::sinks::sink> sink, uint32_t capacity, LogOverflowPolicy policy)
+    : m_Sink(std::move(sink)), m_Slots(new Slot[RoundUpToPowerOfTwo(capacity)]),
+      m_Mask(RoundUpToPowerOfTwo(capacity) - 1), m_Policy(policy)
+{
+    for (uint64_t i = 0; i <= m_Mask; i++)
+        m_Slots[i].Sequence.store(i, std::memory_order_relaxed);
+
+    m_Thread = std::thread(&AsyncLogSink::WriterThread, this);
+}
+
+AsyncLogSink::~AsyncLogSink()
+{
+    m_Running.store(false, std::memory_order_release);
+    m_Wake.notify_one();
+    m_Thread.join();
+}
+
+void AsyncLogSink::log(const spdlog::details::log_msg& msg)
+{
+    if (TryPush(msg))
+    {
+        m_Wake.notify_one();
+        return;
+    }
+
+    if (m_Policy == LogOverflowPolicy::Drop && msg.level < spdlog::level::err)
+    {
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    do
+    {
+        m_Wake.notify_one();
+        std::this_thread::yield();
+    } while (!TryPush(msg));
+    m_Wake.notify_one();
+}
+
+void AsyncLogSink::flush()
+{
+    const uint64_t target = m_Head.load(std::memory_order_acquire);
+    while (m_Tail.load(std::memory_order_acquire) < target)
+    {
+        m_Wake.notify_one();
+        std::this_thread::yield();
+    }
+
+    m_Sink->flush();
+}
+
+void AsyncLogSink::set_pattern(const std::string& pattern)
+{
+    m_Sink->set_pattern(pattern);
+}
+
+void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> formatter)
+{
+    m_Sink->set_formatter(std::move(formatter));
+}
+
+bool AsyncLogSink::TryPush(const spdlog::details::log_msg& msg)
+{
+    uint64_t ticket = m_Head.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (;;)
+    {
+        slot = &m_Slots[ticket & m_Mask];
+        const uint64_t sequence = slot->Sequence.load(std::memory_order_acquire);
+        const int64_t difference = static_cast<int64_t>(sequence - ticket);
+        if (difference == 0)
+        {
+            if (m_Head.compare_exchange_weak(ticket, ticket + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+        {
+            return false; // NOTE: The writer thread has not freed this slot yet; the queue is full
+        }
+        else
+        {
+            ticket = m_Head.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->Time = msg.time;
+    slot->Level = msg.level;
+    slot->ThreadID = msg.thread_id;
+    slot->LoggerNameSize = static_cast<uint32_t>(std::min<size_t>(msg.logger_name.size(), MaxLoggerNameSize));
+    std::memcpy(slot->LoggerName, msg.logger_name.data(), slot->LoggerNameSize);
+    slot->PayloadSize = static_cast<uint32_t>(std::min<size_t>(msg.payload.size(), MaxPayloadSize));
+    std::memcpy(slot->Payload, msg.payload.data(), slot->PayloadSize);
+
+    slot->Sequence.store(ticket + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncLogSink::TryPop()
+{
+    const uint64_t ticket = m_Tail.load(std::memory_order_relaxed);
+    Slot& slot = m_Slots[ticket & m_Mask];
+    if (slot.Sequence.load(std::memory_order_acquire) != ticket + 1)
+        return false;
+
+    spdlog::details::log_msg msg(slot.Time, spdlog::source_loc{},
+                                 spdlog::string_view_t(slot.LoggerName, slot.LoggerNameSize), slot.Level,
+                                 spdlog::string_view_t(slot.Payload, slot.PayloadSize));
+    msg.thread_id = slot.ThreadID;
+    m_Sink->log(msg);
+
+    slot.Sequence.store(ticket + m_Mask + 1, std::memory_order_release);
+    m_Tail.store(ticket + 1, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogSink::WriterThread()
+{
+    for (;;)
+    {
+        bool wrote = false;
+        while (TryPop())
+            wrote = true;
+
+        if (!m_Running.load(std::memory_order_acquire))
+            break;
+
+        // NOTE: Producers notify without the mutex, so a wakeup can be missed; the timeout bounds the delay
+        if (!wrote)
+        {
+            std::unique_lock<std::mutex> lock(m_WakeMutex);
+            m_Wake.wait_for(lock, std::chrono::milliseconds(10));
+        }
+    }
+
+    // NOTE: Producers are gone by now; anything they published is still written
+    while (TryPop())
+        ;
+    m_Sink->flush();
+}
+
+} // namespace Hazel
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "spdlog/sinks/sink.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Hazel
+{
+
+enum class LogOverflowPolicy : uint8_t
+{
+    Block = 0, // NOTE: The logging thread waits for the writer thread to free a slot
+    Drop       // NOTE: Messages below error are dropped and counted; errors and above still wait
+};
+
+// NOTE: Moves console I/O off the logging thread. log() copies the already formatted payload into a slot of a
+// bounded multi-producer queue without taking a lock; one writer thread drains the queue into the wrapped
+// sink. Payloads longer than MaxPayloadSize and logger names longer than MaxLoggerNameSize are truncated.
+//
+// flush() waits until everything queued before it has been written, so flush_on(err) keeps errors (and
+// therefore failed asserts) on screen before the process breaks.
+class AsyncLogSink : public spdlog::sinks::sink
+{
+public:
+    static constexpr uint32_t MaxPayloadSize = 256;
+    static constexpr uint32_t MaxLoggerNameSize = 32;
+
+    AsyncLogSink(std::shared_ptr<spdlog::sinks::sink> sink, uint32_t capacity = 4096,
+                 LogOverflowPolicy policy = LogOverflowPolicy::Drop);
+    virtual ~AsyncLogSink() override;
+
+    virtual void log(const spdlog::details::log_msg& msg) override;
+    virtual void flush() override;
+    virtual void set_pattern(const std::string& pattern) override;
+    virtual void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+    uint64_t GetDroppedCount() const
+    {
+        return m_Dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot
+    {
+        // NOTE: Vyukov sequence; equals the slot's ticket when free and ticket + 1 once a message is in it
+        std::atomic<uint64_t> Sequence;
+        spdlog::log_clock::time_point Time;
+        spdlog::level::level_enum Level;
+        size_t ThreadID;
+        // NOTE: Copied, since a logger can be dropped while its messages are still queued
+        char LoggerName[MaxLoggerNameSize];
+        uint32_t LoggerNameSize;
+        uint32_t PayloadSize;
+        char Payload[MaxPayloadSize];
+    };
+
+    bool TryPush(const spdlog::details::log_msg& msg);
+    bool TryPop();
+    void WriterThread();
+
+private:
+    std::shared_ptr<spdlog::sinks::sink> m_Sink;
+    std::unique_ptr<Slot[]> m_Slots;
+    const uint64_t m_Mask;
+    const LogOverflowPolicy m_Policy;
+
+    std::atomic<uint64_t> m_Head{0}; // NOTE: Next ticket handed to a producer
+    std::atomic<uint64_t> m_Tail{0}; // NOTE: Next ticket the writer thread reads; only it writes this
+    std::atomic<uint64_t> m_Dropped{0};
+
+    std::atomic<bool> m_Running{true};
+    std::mutex m_WakeMutex;
+    std::condition_variable m_Wake;
+    std::thread m_Thread;
+};
+
+} // namespace Hazel
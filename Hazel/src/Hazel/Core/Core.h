@@ -1,8 +1,9 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
-#if defined(HZ_PLATFORM_MACOS)
+#if defined(HZ_PLATFORM_MACOS) || defined(HZ_PLATFORM_LINUX)
 #include <csignal>
 #endif
 
@@ -16,13 +17,13 @@
 #else
 #define HAZEL_API
 #endif
-#elif defined(HZ_PLATFORM_MACOS)
+#elif defined(HZ_PLATFORM_MACOS) || defined(HZ_PLATFORM_LINUX)
 #define HAZEL_API
 #endif
 
 #if defined(HZ_PLATFORM_WINDOWS)
 #define HZ_DEBUGBREAK() __debugbreak()
-#elif defined(HZ_PLATFORM_MACOS)
+#elif defined(HZ_PLATFORM_MACOS) || defined(HZ_PLATFORM_LINUX)
 #define HZ_DEBUGBREAK() raise(SIGTRAP)
 #else
 #define HZ_DEBUGBREAK()
@@ -52,7 +53,10 @@
 
 #define BIT(x) (1 << x)
 
-#define HZ_BIND_EVENT_FN(x) std::bind(&x, this, std::placeholders::_1)
+// NOTE: A lambda rather than std::bind, so EventDispatcher::Dispatch can inline the call. fn is qualified
+// (Class::Method), so it goes through a member pointer; calling this->Class::Method would skip virtual dispatch.
+#define HZ_BIND_EVENT_FN(fn)                                                                                           \
+    [this](auto&&... args) -> decltype(auto) { return std::invoke(&fn, this, std::forward<decltype(args)>(args)...); }
 
 namespace Hazel
 {
@@ -1,6 +1,6 @@
 #pragma once
 
-#if defined(HZ_PLATFORM_WINDOWS) || defined(HZ_PLATFORM_MACOS)
+#if defined(HZ_PLATFORM_WINDOWS) || defined(HZ_PLATFORM_MACOS) || defined(HZ_PLATFORM_LINUX)
 
 extern Hazel::Application* Hazel::CreateApplication();
 
@@ -9,9 +9,19 @@ int main(int argc, char** argv)
     Hazel::Log::Init();
     HZ_CORE_WARN("Initialized");
 
+    HZ_PROFILE_BEGIN_SESSION("Startup", "HazelProfile-Startup.json");
     auto app = Hazel::CreateApplication();
+    HZ_PROFILE_END_SESSION();
+
+    HZ_PROFILE_BEGIN_SESSION("Runtime", "HazelProfile-Runtime.json");
     app->Run();
+    HZ_PROFILE_END_SESSION();
+
+    HZ_PROFILE_BEGIN_SESSION("Shutdown", "HazelProfile-Shutdown.json");
     delete app;
+    HZ_PROFILE_END_SESSION();
+
+    Hazel::Log::Shutdown();
 }
 
 #endif
@@ -7,6 +7,8 @@
 #include <mach-o/dyld.h>
 #elif defined(HZ_PLATFORM_WINDOWS)
 #include <Windows.h>
+#elif defined(HZ_PLATFORM_LINUX)
+#include <unistd.h>
 #endif
 
 namespace Hazel
@@ -55,6 +57,13 @@ static fs::path GetExecutableDirectory()
     }
 
     return fs::path(buffer.data(), buffer.data() + length).parent_path().lexically_normal();
+#elif defined(HZ_PLATFORM_LINUX)
+    std::error_code ec;
+    const fs::path executable = fs::read_symlink("/proc/self/exe", ec);
+    if (ec)
+        return {};
+
+    return executable.parent_path().lexically_normal();
 #else
     return {};
 #endif
@@ -0,0 +1,167 @@
+#include "hzpch.h"
+#include "FramePacer.h"
+
+#include "Hazel/Core/Time.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace Hazel
+{
+
+#if defined(HZ_PLATFORM_WINDOWS) && !defined(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION)
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+#if defined(HZ_PLATFORM_WINDOWS)
+static constexpr uint64_t s_SleepQuantumNanoseconds = 15625000;
+#endif
+
+FramePacer::FramePacer(double targetFrameRate, uint32_t windowSize) : m_Frames(std::max(windowSize, 1u))
+{
+#if defined(HZ_PLATFORM_WINDOWS)
+    m_Timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif
+    SetTargetFrameRate(targetFrameRate);
+}
+
+FramePacer::~FramePacer()
+{
+#if defined(HZ_PLATFORM_WINDOWS)
+    if (m_Timer)
+        CloseHandle(m_Timer);
+#endif
+}
+
+void FramePacer::WaitUntil(uint64_t deadline) const
+{
+    uint64_t spinThreshold = m_SpinThreshold;
+#if defined(HZ_PLATFORM_WINDOWS)
+    if (!m_Timer)
+        spinThreshold = std::max(spinThreshold, s_SleepQuantumNanoseconds);
+#endif
+
+    const uint64_t now = Time::GetNanoseconds();
+    if (deadline > now + spinThreshold)
+    {
+        const uint64_t sleep = deadline - now - spinThreshold;
+#if defined(HZ_PLATFORM_WINDOWS)
+        if (m_Timer)
+        {
+            // NOTE: Negative due times are relative, in 100 ns units
+            LARGE_INTEGER dueTime;
+            dueTime.QuadPart = -static_cast<LONGLONG>(sleep / 100);
+            if (SetWaitableTimer(m_Timer, &dueTime, 0, nullptr, nullptr, FALSE))
+                WaitForSingleObject(m_Timer, INFINITE);
+        }
+        else
+#endif
+            std::this_thread::sleep_for(std::chrono::nanoseconds(sleep));
+    }
+
+    while (Time::GetNanoseconds() < deadline)
+        std::this_thread::yield();
+}
+
+void FramePacer::SetTargetFrameRate(double framesPerSecond)
+{
+    m_TargetFrameRate = std::max(framesPerSecond, 0.0);
+    m_Period = m_TargetFrameRate > 0.0 ? static_cast<uint64_t>(std::llround(1e9 / m_TargetFrameRate)) : 0;
+    m_Deadline = 0;
+}
+
+void FramePacer::Pace()
+{
+    HZ_PROFILE_FUNCTION();
+
+    uint64_t now = Time::GetNanoseconds();
+    bool late = false;
+
+    if (m_Period && m_Deadline)
+    {
+        if (now < m_Deadline)
+        {
+            WaitUntil(m_Deadline);
+            now = Time::GetNanoseconds();
+        }
+        else
+        {
+            late = true;
+        }
+
+        m_Deadline += m_Period;
+        if (now >= m_Deadline)
+            m_Deadline = now + m_Period;
+    }
+    else if (m_Period)
+    {
+        m_Deadline = now + m_Period;
+    }
+
+    Record(now, late);
+}
+
+void FramePacer::Restart()
+{
+    m_Deadline = 0;
+    m_LastFrame = 0;
+}
+
+void FramePacer::Record(uint64_t now, bool late)
+{
+    const uint64_t last = m_LastFrame;
+    m_LastFrame = now;
+    if (!last)
+        return;
+
+    const uint32_t capacity = static_cast<uint32_t>(m_Frames.size());
+    m_Frames[m_Next] = {static_cast<float>(static_cast<double>(now - last) * 1e-6), late};
+    m_Next = (m_Next + 1) % capacity;
+    m_Count = std::min(m_Count + 1, capacity);
+    m_Dirty = true;
+}
+
+const FramePacingSummary& FramePacer::GetSummary() const
+{
+    if (m_Dirty)
+        Summarize();
+    return m_Summary;
+}
+
+void FramePacer::Summarize() const
+{
+    // NOTE: Order within the window does not matter for any of the statistics
+    m_Summary = FramePacingSummary();
+    if (m_Count == 0)
+    {
+        m_Dirty = false;
+        return;
+    }
+
+    double sum = 0.0;
+    for (uint32_t i = 0; i < m_Count; i++)
+    {
+        sum += m_Frames[i].Interval;
+        if (m_Frames[i].Late)
+            m_Summary.LateFrames++;
+    }
+    const double average = sum / m_Count;
+
+    double squares = 0.0;
+    double maxDeviation = 0.0;
+    for (uint32_t i = 0; i < m_Count; i++)
+    {
+        const double deviation = std::abs(m_Frames[i].Interval - average);
+        squares += deviation * deviation;
+        maxDeviation = std::max(maxDeviation, deviation);
+    }
+
+    m_Summary.Interval = static_cast<float>(average);
+    m_Summary.Jitter = static_cast<float>(std::sqrt(squares / m_Count));
+    m_Summary.MaxDeviation = static_cast<float>(maxDeviation);
+    m_Dirty = false;
+}
+
+} // namespace Hazel
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Hazel
+{
+
+struct FramePacingSummary
+{
+    float Interval = 0.0f;     // NOTE: Average milliseconds from one frame to the next
+    float Jitter = 0.0f;       // NOTE: Standard deviation of the interval, milliseconds
+    float MaxDeviation = 0.0f; // NOTE: Furthest a single interval strayed from the average, milliseconds
+    uint32_t LateFrames = 0;   // NOTE: Frames that were already past their deadline when paced
+};
+
+// NOTE: Caps the frame rate by holding each frame until its deadline. Deadlines advance by whole periods, so
+// an oversleep on one frame is taken out of the next wait instead of drifting the schedule; a frame more than
+// a period behind starts a new schedule rather than rushing through catch-up frames.
+//
+// The OS sleep is only trusted to within the spin threshold; the rest of the wait yields in a loop on Time.
+// Plain sleeps on Windows round up to the 15.6 ms timer quantum, so there the pacer sleeps on a
+// high-resolution waitable timer instead. Windows before 10 (1803) has none; the spin threshold then
+// grows to a whole quantum.
+//
+// Every paced frame is measured, capped or not, over a rolling window of intervals.
+class FramePacer
+{
+public:
+    static constexpr uint64_t DefaultSpinNanoseconds = 2000000;
+
+    FramePacer(double targetFrameRate = 0.0, uint32_t windowSize = 120);
+    ~FramePacer();
+    FramePacer(const FramePacer&) = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+
+    // NOTE: Zero leaves the frame rate uncapped
+    void SetTargetFrameRate(double framesPerSecond);
+    inline double GetTargetFrameRate() const
+    {
+        return m_TargetFrameRate;
+    }
+    inline void SetSpinThreshold(uint64_t nanoseconds)
+    {
+        m_SpinThreshold = nanoseconds;
+    }
+
+    // NOTE: Called once per frame, after presenting. Blocks until the next frame is due.
+    void Pace();
+    // NOTE: Drops the schedule and the pending interval, e.g. after the loop blocked on window events; the gap
+    // is not measured
+    void Restart();
+
+    const FramePacingSummary& GetSummary() const;
+    inline uint32_t GetFrameCount() const
+    {
+        return m_Count;
+    }
+
+private:
+    struct PacedFrame
+    {
+        float Interval = 0.0f;
+        bool Late = false;
+    };
+
+    void WaitUntil(uint64_t deadline) const;
+    void Record(uint64_t now, bool late);
+    void Summarize() const;
+
+private:
+    double m_TargetFrameRate = 0.0;
+    uint64_t m_Period = 0;
+    uint64_t m_SpinThreshold = DefaultSpinNanoseconds;
+    uint64_t m_Deadline = 0;
+    uint64_t m_LastFrame = 0;
+    void* m_Timer = nullptr; // NOTE: Windows waitable timer handle
+
+    std::vector<PacedFrame> m_Frames;
+    uint32_t m_Next = 0;
+    uint32_t m_Count = 0;
+
+    // NOTE: Cached by Summarize
+    mutable bool m_Dirty = false;
+    mutable FramePacingSummary m_Summary;
+};
+
+} // namespace Hazel
@@ -0,0 +1,145 @@
+#include "hzpch.h"
+#include "FrameStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Hazel
+{
+
+// NOTE: Nearest-rank percentile over an unsorted range; reorders the range
+static float Percentile(std::vector<float>& values, float percentile)
+{
+    const size_t rank = static_cast<size_t>(std::ceil(percentile * values.size()));
+    const size_t index = std::min(values.size() - 1, rank > 0 ? rank - 1 : 0);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+static FrameTimeSummary SummarizeValues(std::vector<float>& values)
+{
+    FrameTimeSummary summary;
+    if (values.empty())
+        return summary;
+
+    float sum = 0.0f;
+    for (float value : values)
+        sum += value;
+    summary.Average = sum / values.size();
+
+    summary.P50 = Percentile(values, 0.50f);
+    summary.P95 = Percentile(values, 0.95f);
+    summary.P99 = Percentile(values, 0.99f);
+    summary.Max = *std::max_element(values.begin(), values.end());
+    return summary;
+}
+
+FrameStatistics::FrameStatistics(uint32_t windowSize, float budgetMilliseconds)
+    : m_Frames(std::max(windowSize, 1u)), m_Budget(budgetMilliseconds)
+{
+    m_Scratch.reserve(m_Frames.size());
+}
+
+uint32_t FrameStatistics::GetBucket(float milliseconds)
+{
+    const float bucket = std::max(milliseconds, 0.0f) / HistogramBucketMilliseconds;
+    return std::min(static_cast<uint32_t>(bucket), HistogramBucketCount - 1);
+}
+
+void FrameStatistics::AddFrame(const FrameTimings& timings)
+{
+    const uint32_t capacity = static_cast<uint32_t>(m_Frames.size());
+    if (m_Count == capacity)
+    {
+        const FrameTimings& evicted = m_Frames[m_Next];
+        m_Histogram[GetBucket(evicted.Total)]--;
+        if (evicted.Total > m_Budget)
+            m_FramesOverBudget--;
+    }
+    else
+    {
+        m_Count++;
+    }
+
+    m_Frames[m_Next] = timings;
+    m_Next = (m_Next + 1) % capacity;
+    m_TotalFrameCount++;
+
+    m_Histogram[GetBucket(timings.Total)]++;
+    if (timings.Total > m_Budget)
+    {
+        m_FramesOverBudget++;
+        m_TotalFramesOverBudget++;
+    }
+
+    m_Dirty = true;
+}
+
+void FrameStatistics::Reset()
+{
+    m_Next = 0;
+    m_Count = 0;
+    m_TotalFrameCount = 0;
+    m_FramesOverBudget = 0;
+    m_TotalFramesOverBudget = 0;
+    m_Histogram = {};
+    m_Summary = {};
+    m_PhaseSummaries = {};
+    m_Dirty = false;
+}
+
+void FrameStatistics::SetBudget(float milliseconds)
+{
+    m_Budget = milliseconds;
+
+    m_FramesOverBudget = 0;
+    for (uint32_t i = 0; i < m_Count; i++)
+    {
+        if (m_Frames[i].Total > m_Budget)
+            m_FramesOverBudget++;
+    }
+}
+
+const FrameTimeSummary& FrameStatistics::GetSummary() const
+{
+    if (m_Dirty)
+        Summarize();
+    return m_Summary;
+}
+
+const FrameTimeSummary& FrameStatistics::GetPhaseSummary(FramePhase phase) const
+{
+    if (m_Dirty)
+        Summarize();
+    return m_PhaseSummaries[static_cast<size_t>(phase)];
+}
+
+const FrameTimings& FrameStatistics::GetLastFrame() const
+{
+    static const FrameTimings s_Empty;
+    if (m_Count == 0)
+        return s_Empty;
+
+    const uint32_t capacity = static_cast<uint32_t>(m_Frames.size());
+    return m_Frames[(m_Next + capacity - 1) % capacity];
+}
+
+void FrameStatistics::Summarize() const
+{
+    // NOTE: Order within the window does not matter for any of the statistics
+    m_Scratch.resize(m_Count);
+    for (uint32_t i = 0; i < m_Count; i++)
+        m_Scratch[i] = m_Frames[i].Total;
+    m_Summary = SummarizeValues(m_Scratch);
+
+    for (size_t phase = 0; phase < m_PhaseSummaries.size(); phase++)
+    {
+        for (uint32_t i = 0; i < m_Count; i++)
+            m_Scratch[i] = m_Frames[i].Phases[phase];
+        m_PhaseSummaries[phase] = SummarizeValues(m_Scratch);
+    }
+
+    m_Dirty = false;
+}
+
+} // namespace Hazel
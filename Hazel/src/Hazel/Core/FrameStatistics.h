@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Hazel
+{
+
+enum class FramePhase : uint8_t
+{
+    Update = 0, // NOTE: Layer::OnUpdate
+    Render,     // NOTE: Layer::OnRender; renderer submission
+    ImGui,      // NOTE: Layer::OnImGuiRender and ImGui rendering
+    Swap,       // NOTE: Window::OnUpdate; events, buffer swap and vsync wait
+
+    Count
+};
+
+struct FrameTimings
+{
+    float Total = 0.0f; // NOTE: Milliseconds, like every phase
+    std::array<float, static_cast<size_t>(FramePhase::Count)> Phases = {};
+};
+
+struct FrameTimeSummary
+{
+    float Average = 0.0f;
+    float P50 = 0.0f;
+    float P95 = 0.0f;
+    float P99 = 0.0f;
+    float Max = 0.0f;
+};
+
+// NOTE: Rolling window over the most recent frames. Adding a frame is O(1) and keeps the histogram and budget
+// counts current; percentiles are computed with nth_element on the first query after a frame was added and
+// cached until the next one.
+class FrameStatistics
+{
+public:
+    static constexpr uint32_t HistogramBucketCount = 34;
+    static constexpr float HistogramBucketMilliseconds = 1.0f; // NOTE: The last bucket also holds everything above
+
+    FrameStatistics(uint32_t windowSize = 300, float budgetMilliseconds = 1000.0f / 60.0f);
+
+    void AddFrame(const FrameTimings& timings);
+    void Reset();
+
+    void SetBudget(float milliseconds);
+    float GetBudget() const
+    {
+        return m_Budget;
+    }
+
+    const FrameTimeSummary& GetSummary() const;
+    const FrameTimeSummary& GetPhaseSummary(FramePhase phase) const;
+
+    const std::array<uint32_t, HistogramBucketCount>& GetHistogram() const
+    {
+        return m_Histogram;
+    }
+    // NOTE: Within the window
+    uint32_t GetFramesOverBudget() const
+    {
+        return m_FramesOverBudget;
+    }
+    uint64_t GetTotalFramesOverBudget() const
+    {
+        return m_TotalFramesOverBudget;
+    }
+
+    uint32_t GetFrameCount() const
+    {
+        return m_Count;
+    }
+    uint64_t GetTotalFrameCount() const
+    {
+        return m_TotalFrameCount;
+    }
+    const FrameTimings& GetLastFrame() const;
+
+private:
+    static uint32_t GetBucket(float milliseconds);
+    void Summarize() const;
+
+private:
+    std::vector<FrameTimings> m_Frames;
+    uint32_t m_Next = 0;
+    uint32_t m_Count = 0;
+    uint64_t m_TotalFrameCount = 0;
+
+    float m_Budget;
+    uint32_t m_FramesOverBudget = 0;
+    uint64_t m_TotalFramesOverBudget = 0;
+    std::array<uint32_t, HistogramBucketCount> m_Histogram = {};
+
+    // NOTE: Cached by Summarize
+    mutable bool m_Dirty = false;
+    mutable FrameTimeSummary m_Summary;
+    mutable std::array<FrameTimeSummary, static_cast<size_t>(FramePhase::Count)> m_PhaseSummaries = {};
+    mutable std::vector<float> m_Scratch;
+};
+
+} // namespace Hazel
@@ -0,0 +1,96 @@
+#include "hzpch.h"
+#include "Input.h"
+
+#include "Hazel/Events/KeyEvent.h"
+#include "Hazel/Events/MouseEvent.h"
+
+namespace Hazel
+{
+
+InputSnapshot Input::s_Pending;
+InputSnapshot Input::s_Snapshots[3];
+std::atomic<uint32_t> Input::s_Current{0};
+
+void Input::OnEvent(const Event& event)
+{
+    InputSnapshot& state = s_Pending;
+    switch (event.GetEventType())
+    {
+    case EventType::KeyPressed: {
+        // NOTE: Repeats keep the key held without adding another edge
+        const int keycode = static_cast<const KeyEvent&>(event).GetKeyCode();
+        if (InputSnapshot::IsKey(keycode) && !state.m_Keys[keycode])
+        {
+            state.m_Keys[keycode] = true;
+            state.m_KeysPressed[keycode] = true;
+        }
+        break;
+    }
+    case EventType::KeyReleased: {
+        const int keycode = static_cast<const KeyEvent&>(event).GetKeyCode();
+        if (InputSnapshot::IsKey(keycode))
+        {
+            state.m_Keys[keycode] = false;
+            state.m_KeysReleased[keycode] = true;
+        }
+        break;
+    }
+    case EventType::MouseButtonPressed: {
+        const int button = static_cast<const MouseButtonEvent&>(event).GetMouseButton();
+        if (InputSnapshot::IsMouseButton(button))
+        {
+            state.m_MouseButtons[button] = true;
+            state.m_MouseButtonsPressed[button] = true;
+        }
+        break;
+    }
+    case EventType::MouseButtonReleased: {
+        const int button = static_cast<const MouseButtonEvent&>(event).GetMouseButton();
+        if (InputSnapshot::IsMouseButton(button))
+        {
+            state.m_MouseButtons[button] = false;
+            state.m_MouseButtonsReleased[button] = true;
+        }
+        break;
+    }
+    case EventType::MouseMoved: {
+        const auto& e = static_cast<const MouseMovedEvent&>(event);
+        state.m_MouseX = e.GetX();
+        state.m_MouseY = e.GetY();
+        break;
+    }
+    case EventType::MouseScrolled: {
+        const auto& e = static_cast<const MouseScrolledEvent&>(event);
+        state.m_ScrollX += e.GetXOffset();
+        state.m_ScrollY += e.GetYOffset();
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void Input::BeginFrame()
+{
+    // NOTE: The slot written here was published two frames ago; see the triple buffering note in Input.h
+    const uint32_t next = (s_Current.load(std::memory_order_relaxed) + 1) % 3;
+    s_Snapshots[next] = s_Pending;
+    s_Current.store(next, std::memory_order_release);
+
+    s_Pending.m_KeysPressed.reset();
+    s_Pending.m_KeysReleased.reset();
+    s_Pending.m_MouseButtonsPressed.reset();
+    s_Pending.m_MouseButtonsReleased.reset();
+    s_Pending.m_ScrollX = 0.0f;
+    s_Pending.m_ScrollY = 0.0f;
+    s_Pending.m_Frame++;
+}
+
+void Input::Reset()
+{
+    const uint64_t frame = s_Pending.m_Frame;
+    s_Pending = InputSnapshot();
+    s_Pending.m_Frame = frame;
+}
+
+} // namespace Hazel
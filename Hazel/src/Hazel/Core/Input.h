@@ -1,42 +1,150 @@
 #pragma once
 
 #include "Hazel/Core/Core.h"
+#include "Hazel/Core/KeyCodes.h"
+#include "Hazel/Core/MouseButtonCodes.h"
+#include "Hazel/Events/Event.h"
+
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <utility>
 
 namespace Hazel
 {
 
+// NOTE: The input state of one frame. Pressed/Released edges are set when a key or button changed during the
+// events that led up to the frame, so a tap shorter than a frame still shows up as both.
+class InputSnapshot
+{
+public:
+    static constexpr int KeyCount = HZ_KEY_MENU + 1;
+    static constexpr int MouseButtonCount = HZ_MOUSE_BUTTON_LAST + 1;
+
+    inline bool IsKeyPressed(int keycode) const
+    {
+        return IsKey(keycode) && m_Keys[keycode];
+    }
+    inline bool WasKeyPressed(int keycode) const
+    {
+        return IsKey(keycode) && m_KeysPressed[keycode];
+    }
+    inline bool WasKeyReleased(int keycode) const
+    {
+        return IsKey(keycode) && m_KeysReleased[keycode];
+    }
+
+    inline bool IsMouseButtonPressed(int button) const
+    {
+        return IsMouseButton(button) && m_MouseButtons[button];
+    }
+    inline bool WasMouseButtonPressed(int button) const
+    {
+        return IsMouseButton(button) && m_MouseButtonsPressed[button];
+    }
+    inline bool WasMouseButtonReleased(int button) const
+    {
+        return IsMouseButton(button) && m_MouseButtonsReleased[button];
+    }
+
+    inline float GetMouseX() const
+    {
+        return m_MouseX;
+    }
+    inline float GetMouseY() const
+    {
+        return m_MouseY;
+    }
+    inline std::pair<float, float> GetMousePosition() const
+    {
+        return {m_MouseX, m_MouseY};
+    }
+    // NOTE: Summed over the frame's scroll events
+    inline float GetScrollX() const
+    {
+        return m_ScrollX;
+    }
+    inline float GetScrollY() const
+    {
+        return m_ScrollY;
+    }
+
+    inline uint64_t GetFrame() const
+    {
+        return m_Frame;
+    }
+
+private:
+    static inline bool IsKey(int keycode)
+    {
+        return keycode >= 0 && keycode < KeyCount;
+    }
+    static inline bool IsMouseButton(int button)
+    {
+        return button >= 0 && button < MouseButtonCount;
+    }
+
+private:
+    std::bitset<KeyCount> m_Keys;
+    std::bitset<KeyCount> m_KeysPressed;
+    std::bitset<KeyCount> m_KeysReleased;
+    std::bitset<MouseButtonCount> m_MouseButtons;
+    std::bitset<MouseButtonCount> m_MouseButtonsPressed;
+    std::bitset<MouseButtonCount> m_MouseButtonsReleased;
+    float m_MouseX = 0.0f;
+    float m_MouseY = 0.0f;
+    float m_ScrollX = 0.0f;
+    float m_ScrollY = 0.0f;
+    uint64_t m_Frame = 0;
+
+    friend class Input;
+};
+
+// NOTE: Input is built from the event stream rather than polled from the window. Application::OnEvent feeds
+// every event to OnEvent, and Application::Run calls BeginFrame once the frame's events are dispatched. That
+// publishes everything seen so far as an immutable snapshot.
+//
+// Snapshots are triple buffered: a reference from GetSnapshot stays valid and unchanged until the second
+// BeginFrame after it was taken, so jobs and the render thread may read it while the next frame starts.
+// OnEvent and BeginFrame belong to the main thread.
 class Input
 {
 public:
+    inline static const InputSnapshot& GetSnapshot()
+    {
+        return s_Snapshots[s_Current.load(std::memory_order_acquire)];
+    }
+
     inline static bool IsKeyPressed(int keycode)
     {
-        return s_Instance->IsKeyPressedImpl(keycode);
+        return GetSnapshot().IsKeyPressed(keycode);
     }
     inline static bool IsMouseButtonPressed(int button)
     {
-        return s_Instance->IsMouseButtonPressedImpl(button);
+        return GetSnapshot().IsMouseButtonPressed(button);
     }
     inline static float GetMouseX()
     {
-        return s_Instance->GetMouseXImpl();
+        return GetSnapshot().GetMouseX();
     }
     inline static float GetMouseY()
     {
-        return s_Instance->GetMouseYImpl();
+        return GetSnapshot().GetMouseY();
     }
     inline static std::pair<float, float> GetMousePosition()
     {
-        return s_Instance->GetMousePositionImpl();
+        return GetSnapshot().GetMousePosition();
     }
 
-protected:
-    virtual bool IsKeyPressedImpl(int keycode) = 0;
-    virtual bool IsMouseButtonPressedImpl(int button) = 0;
-    virtual float GetMouseXImpl() = 0;
-    virtual float GetMouseYImpl() = 0;
-    virtual std::pair<float, float> GetMousePositionImpl() = 0;
+    static void OnEvent(const Event& event);
+    static void BeginFrame();
+    // NOTE: Drops all held keys and buttons, e.g. before a replay starts
+    static void Reset();
 
 private:
-    static Input* s_Instance;
+    static InputSnapshot s_Pending;
+    static InputSnapshot s_Snapshots[3];
+    static std::atomic<uint32_t> s_Current;
 };
-} // namespace Hazel
\ No newline at end of file
+
+} // namespace Hazel
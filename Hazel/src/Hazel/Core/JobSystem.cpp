@@ -0,0 +1,255 @@
+#include "hzpch.h"
+#include "JobSystem.h"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+#if defined(HZ_PLATFORM_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Hazel
+{
+
+static constexpr uint32_t s_MaxWorkers = 63;
+static constexpr uint32_t s_NoQueue = std::numeric_limits<uint32_t>::max();
+
+struct JobQueue
+{
+    std::mutex Mutex;
+    std::deque<Job> Jobs;
+};
+
+struct JobSystemData
+{
+    // NOTE: Index 0 belongs to the main thread, index i + 1 to worker i
+    std::vector<std::unique_ptr<JobQueue>> Queues;
+    std::vector<std::thread> Workers;
+
+    std::atomic<uint32_t> QueuedJobs{0};
+    std::atomic<uint32_t> SleepingWorkers{0};
+    std::mutex WakeMutex;
+    std::condition_variable Wake;
+    bool Stopping = false;
+};
+
+static JobSystemData* s_Data = nullptr;
+static thread_local uint32_t s_QueueIndex = s_NoQueue;
+
+static void PinToCore(std::thread& thread, uint32_t core)
+{
+#if defined(HZ_PLATFORM_WINDOWS)
+    SetThreadAffinityMask(thread.native_handle(), DWORD_PTR(1) << core);
+#elif defined(HZ_PLATFORM_LINUX)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#endif
+}
+
+void JobSystem::Push(Job&& job)
+{
+    if (!s_Data)
+    {
+        job.Function();
+        Finish(job.Counter);
+        return;
+    }
+
+    const uint32_t index = s_QueueIndex == s_NoQueue ? 0 : s_QueueIndex;
+    JobQueue& queue = *s_Data->Queues[index];
+    {
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        queue.Jobs.push_back(std::move(job));
+    }
+
+    // NOTE: Sequentially consistent on purpose: either this sees the sleeper, or the sleeper sees the job
+    s_Data->QueuedJobs.fetch_add(1);
+    if (s_Data->SleepingWorkers.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(s_Data->WakeMutex);
+        s_Data->Wake.notify_one();
+    }
+}
+
+static bool TryPop(uint32_t index, Job& job)
+{
+    JobQueue& queue = *s_Data->Queues[index];
+    std::lock_guard<std::mutex> lock(queue.Mutex);
+    if (queue.Jobs.empty())
+        return false;
+
+    job = std::move(queue.Jobs.back());
+    queue.Jobs.pop_back();
+    return true;
+}
+
+static bool TrySteal(uint32_t index, Job& job)
+{
+    JobQueue& queue = *s_Data->Queues[index];
+    std::lock_guard<std::mutex> lock(queue.Mutex);
+    if (queue.Jobs.empty())
+        return false;
+
+    job = std::move(queue.Jobs.front());
+    queue.Jobs.pop_front();
+    return true;
+}
+
+bool JobSystem::RunOneJob()
+{
+    if (s_Data->QueuedJobs.load(std::memory_order_relaxed) == 0)
+        return false;
+
+    const uint32_t own = s_QueueIndex == s_NoQueue ? 0 : s_QueueIndex;
+    const uint32_t queueCount = static_cast<uint32_t>(s_Data->Queues.size());
+
+    Job job;
+    bool found = TryPop(own, job);
+    for (uint32_t i = 1; !found && i < queueCount; i++)
+        found = TrySteal((own + i) % queueCount, job);
+    if (!found)
+        return false;
+
+    s_Data->QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    job.Function();
+    Finish(job.Counter);
+    return true;
+}
+
+void JobSystem::WorkerLoop(uint32_t queueIndex)
+{
+    s_QueueIndex = queueIndex;
+
+    for (;;)
+    {
+        if (RunOneJob())
+            continue;
+
+        std::unique_lock<std::mutex> lock(s_Data->WakeMutex);
+        s_Data->SleepingWorkers.fetch_add(1);
+        s_Data->Wake.wait(lock, []() { return s_Data->QueuedJobs.load() > 0 || s_Data->Stopping; });
+        s_Data->SleepingWorkers.fetch_sub(1);
+
+        if (s_Data->Stopping && s_Data->QueuedJobs.load() == 0)
+            break;
+    }
+}
+
+// NOTE: Runs under the counter's mutex so a thread returning from Wait cannot destroy the counter while the
+// last job is still releasing its continuations
+void JobSystem::Finish(JobCounter* counter)
+{
+    if (!counter)
+        return;
+
+    std::vector<Job> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter->m_Mutex);
+        if (counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            continuations.swap(counter->m_Continuations);
+    }
+
+    for (Job& job : continuations)
+        Push(std::move(job));
+}
+
+void JobSystem::Init(const JobSystemSpecification& specification)
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (s_Data)
+        Shutdown();
+
+    uint32_t workerCount = specification.WorkerCount;
+    if (workerCount == JobSystemSpecification::AutomaticWorkerCount)
+        workerCount = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+    workerCount = std::min(workerCount, s_MaxWorkers);
+    if (workerCount == 0)
+        return;
+
+    s_Data = new JobSystemData();
+    for (uint32_t i = 0; i <= workerCount; i++)
+        s_Data->Queues.push_back(std::make_unique<JobQueue>());
+
+    s_QueueIndex = 0;
+    for (uint32_t i = 0; i < workerCount; i++)
+    {
+        s_Data->Workers.emplace_back(WorkerLoop, i + 1);
+        if (!specification.CoreAffinity.empty())
+            PinToCore(s_Data->Workers.back(),
+                      specification.CoreAffinity[i % specification.CoreAffinity.size()]);
+    }
+}
+
+void JobSystem::Shutdown()
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (!s_Data)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(s_Data->WakeMutex);
+        s_Data->Stopping = true;
+    }
+    s_Data->Wake.notify_all();
+
+    while (RunOneJob())
+        ;
+    for (std::thread& worker : s_Data->Workers)
+        worker.join();
+    // NOTE: Continuations released by the last jobs on the workers
+    while (RunOneJob())
+        ;
+
+    delete s_Data;
+    s_Data = nullptr;
+    s_QueueIndex = s_NoQueue;
+}
+
+bool JobSystem::IsRunning()
+{
+    return s_Data != nullptr;
+}
+
+uint32_t JobSystem::GetWorkerCount()
+{
+    return s_Data ? static_cast<uint32_t>(s_Data->Workers.size()) : 0;
+}
+
+void JobSystem::Submit(JobFunction function, JobCounter* counter, JobCounter* after)
+{
+    if (counter)
+        counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+    Job job{std::move(function), counter};
+    if (after)
+    {
+        std::lock_guard<std::mutex> lock(after->m_Mutex);
+        if (after->m_Pending.load(std::memory_order_acquire) != 0)
+        {
+            after->m_Continuations.push_back(std::move(job));
+            return;
+        }
+    }
+
+    Push(std::move(job));
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+    while (!counter.IsDone())
+    {
+        if (!s_Data || !RunOneJob())
+            std::this_thread::yield();
+    }
+
+    // NOTE: The thread that finished the last job may still hold the mutex; see Finish
+    std::lock_guard<std::mutex> lock(counter.m_Mutex);
+}
+
+} // namespace Hazel
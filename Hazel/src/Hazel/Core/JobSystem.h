@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace Hazel
+{
+
+struct JobSystemSpecification
+{
+    static constexpr uint32_t AutomaticWorkerCount = std::numeric_limits<uint32_t>::max();
+
+    // NOTE: Automatic starts one worker per hardware thread besides the main thread. Zero starts none and runs
+    // every job inline on the thread that submits it.
+    uint32_t WorkerCount = AutomaticWorkerCount;
+
+    // NOTE: Worker i is pinned to core CoreAffinity[i % size]; empty leaves placement to the OS. Pinning is
+    // supported on Windows and Linux and ignored elsewhere.
+    std::vector<uint32_t> CoreAffinity;
+};
+
+using JobFunction = std::function<void()>;
+
+class JobCounter;
+
+struct Job
+{
+    JobFunction Function;
+    JobCounter* Counter = nullptr;
+};
+
+// NOTE: Counts the unfinished jobs submitted with it. Jobs submitted to run after a counter are held here
+// until it reaches zero. A counter has to outlive its jobs: JobSystem::Wait on it before destroying it.
+class JobCounter
+{
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    inline bool IsDone() const
+    {
+        return m_Pending.load(std::memory_order_acquire) == 0;
+    }
+    inline uint32_t GetPending() const
+    {
+        return m_Pending.load(std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<uint32_t> m_Pending{0};
+    std::mutex m_Mutex;
+    std::vector<Job> m_Continuations;
+
+    friend class JobSystem;
+};
+
+// NOTE: Work-stealing job system. Every worker and the main thread own a deque: the owner pushes and pops at
+// the back, so recently split work stays hot in its cache, and idle threads steal the oldest job from the
+// front of someone else's deque. The deques are guarded by a mutex each and are only ever contended by a
+// thief. Threads that are not part of the system submit to the main thread's deque, where workers steal it.
+//
+// Job functions are std::function; keep captures to two pointers (or a pointer and two 32-bit values, as
+// ParallelFor does) and they are stored without a heap allocation.
+class JobSystem
+{
+public:
+    static void Init(const JobSystemSpecification& specification = JobSystemSpecification());
+    // NOTE: Runs whatever is still queued, then joins the workers
+    static void Shutdown();
+
+    static bool IsRunning();
+    static uint32_t GetWorkerCount();
+
+    // NOTE: counter (optional) is incremented now and decremented once the job has run. With after set, the job
+    // is only queued once after reaches zero.
+    static void Submit(JobFunction function, JobCounter* counter = nullptr, JobCounter* after = nullptr);
+
+    // NOTE: Runs queued jobs on the calling thread until counter reaches zero
+    static void Wait(JobCounter& counter);
+
+    // NOTE: Calls body(begin, end) over [0, count) in chunks of grainSize, the first one on the calling thread,
+    // and returns once all of them are done
+    template <typename F> static void ParallelFor(uint32_t count, uint32_t grainSize, const F& body)
+    {
+        if (count == 0)
+            return;
+
+        grainSize = std::max(grainSize, 1u);
+        if (count <= grainSize || !IsRunning())
+        {
+            body(0u, count);
+            return;
+        }
+
+        JobCounter counter;
+        const F* bodyPtr = &body;
+        for (uint32_t begin = grainSize; begin < count; begin += grainSize)
+        {
+            const uint32_t end = std::min(begin + grainSize, count);
+            Submit([bodyPtr, begin, end]() { (*bodyPtr)(begin, end); }, &counter);
+        }
+
+        body(0u, grainSize);
+        Wait(counter);
+    }
+
+private:
+    static void Push(Job&& job);
+    static bool RunOneJob();
+    static void WorkerLoop(uint32_t queueIndex);
+    static void Finish(JobCounter* counter);
+};
+
+} // namespace Hazel
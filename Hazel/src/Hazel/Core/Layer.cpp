@@ -1,13 +1,21 @@
 #include "hzpch.h"
 #include "Hazel/Core/Layer.h"
 
+#include "Hazel/Core/Application.h"
+
 namespace Hazel
 {
-Layer::Layer(const std::string& debugName) : m_DebugName(debugName)
+Layer::Layer(const std::string& debugName, int eventCategories)
+    : m_DebugName(debugName), m_EventCategories(eventCategories)
 {
 }
 
 Layer::~Layer()
 {
 }
+
+void Layer::Invalidate()
+{
+    Application::Get().Invalidate();
+}
 } // namespace Hazel
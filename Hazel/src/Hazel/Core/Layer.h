@@ -5,13 +5,16 @@
 #include "Hazel/Events/Event.h"
 
 #include <string>
+#include <vector>
 
 namespace Hazel
 {
 class Layer
 {
 public:
-    Layer(const std::string& name = "Layer");
+    // NOTE: eventCategories is a mask of EventCategory flags; Application::OnEvent skips the layer for events
+    // in none of them
+    Layer(const std::string& name = "Layer", int eventCategories = EventCategoryAll);
     virtual ~Layer();
 
     virtual void OnAttach()
@@ -20,9 +23,18 @@ public:
     virtual void OnDetach()
     {
     }
+    // NOTE: Zero or more times per frame before OnUpdate, always with the same timestep; see
+    // ApplicationSpecification::FixedUpdateTimestep. Follows the same concurrency rules as OnUpdate.
+    virtual void OnFixedUpdate(Timestep timestep)
+    {
+    }
     virtual void OnUpdate(Timestep timestep)
     {
     }
+    // NOTE: Called on the main thread after every layer has updated, bottom of the stack first
+    virtual void OnRender()
+    {
+    }
     virtual void OnImGuiRender()
     {
     }
@@ -30,12 +42,50 @@ public:
     {
     }
 
+    // NOTE: Asks the application for another frame; see ApplicationSpecification::RenderOnDemand
+    void Invalidate();
+
     inline const std::string& GetName() const
     {
         return m_DebugName;
     }
+    inline int GetEventCategories() const
+    {
+        return m_EventCategories;
+    }
+    inline void SetEventCategories(int eventCategories)
+    {
+        m_EventCategories = eventCategories;
+    }
+
+    // NOTE: A concurrent layer's OnUpdate may run on a job worker at the same time as other layers' updates,
+    // so it must only touch its own state and read shared state that nobody writes during the update (such
+    // as Input::GetSnapshot). Renderer submission then belongs in OnRender. Layers that are not concurrent
+    // update on the main thread in stack order, as before.
+    //
+    // A dependency delays this layer's update until the other layer's has finished. Only layers lower in the
+    // stack count. Declare both before the layer is pushed or in OnAttach.
+    inline bool IsConcurrentUpdate() const
+    {
+        return m_ConcurrentUpdate;
+    }
+    inline void SetConcurrentUpdate(bool concurrent)
+    {
+        m_ConcurrentUpdate = concurrent;
+    }
+    inline const std::vector<const Layer*>& GetUpdateDependencies() const
+    {
+        return m_UpdateDependencies;
+    }
+    inline void AddUpdateDependency(const Layer* layer)
+    {
+        m_UpdateDependencies.push_back(layer);
+    }
 
 private:
     std::string m_DebugName;
+    int m_EventCategories;
+    bool m_ConcurrentUpdate = false;
+    std::vector<const Layer*> m_UpdateDependencies;
 };
 } // namespace Hazel
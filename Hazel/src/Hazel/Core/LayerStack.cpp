@@ -17,11 +17,13 @@ void LayerStack::PushLayer(Layer* layer)
 {
     m_Layers.emplace(m_Layers.begin() + m_LayerInsertIndex, layer);
     m_LayerInsertIndex++;
+    m_UpdateWavesDirty = true;
 }
 
 void LayerStack::PushOverlay(Layer* overlay)
 {
     m_Layers.emplace_back(overlay);
+    m_UpdateWavesDirty = true;
 }
 
 void LayerStack::PopLayer(Layer* layer)
@@ -31,6 +33,7 @@ void LayerStack::PopLayer(Layer* layer)
     {
         m_Layers.erase(it);
         m_LayerInsertIndex--;
+        m_UpdateWavesDirty = true;
     }
 }
 
@@ -40,6 +43,47 @@ void LayerStack::PopOverlay(Layer* overlay)
     if (it != m_Layers.end())
     {
         m_Layers.erase(it);
+        m_UpdateWavesDirty = true;
+    }
+}
+
+const std::vector<LayerUpdateWave>& LayerStack::GetUpdateWaves()
+{
+    if (m_UpdateWavesDirty)
+        BuildUpdateWaves();
+
+    return m_UpdateWaves;
+}
+
+void LayerStack::BuildUpdateWaves()
+{
+    m_UpdateWaves.clear();
+    m_UpdateWavesDirty = false;
+
+    std::unordered_map<const Layer*, size_t> waveOf;
+    size_t nextSerialWave = 0;
+    for (Layer* layer : m_Layers)
+    {
+        size_t wave = layer->IsConcurrentUpdate() ? 0 : nextSerialWave;
+        for (const Layer* dependency : layer->GetUpdateDependencies())
+        {
+            auto it = waveOf.find(dependency);
+            if (it != waveOf.end())
+                wave = std::max(wave, it->second + 1);
+        }
+        waveOf[layer] = wave;
+
+        if (wave >= m_UpdateWaves.size())
+            m_UpdateWaves.resize(wave + 1);
+        if (layer->IsConcurrentUpdate())
+        {
+            m_UpdateWaves[wave].Concurrent.push_back(layer);
+        }
+        else
+        {
+            m_UpdateWaves[wave].Serial = layer;
+            nextSerialWave = wave + 1;
+        }
     }
 }
 } // namespace Hazel
@@ -8,6 +8,13 @@
 namespace Hazel
 {
 
+// NOTE: Layers whose updates may run at the same time: at most one on the main thread, the rest on jobs
+struct LayerUpdateWave
+{
+    Layer* Serial = nullptr;
+    std::vector<Layer*> Concurrent;
+};
+
 class LayerStack
 {
 public:
@@ -28,8 +35,18 @@ public:
         return m_Layers.end();
     }
 
+    // NOTE: Every layer in exactly one wave; a wave only starts once the previous one has finished. Layers
+    // that are not concurrent form a chain in stack order, and a layer lands in the first wave after all of
+    // its dependencies. Rebuilt on the first call after a push or pop.
+    const std::vector<LayerUpdateWave>& GetUpdateWaves();
+
+private:
+    void BuildUpdateWaves();
+
 private:
     std::vector<Layer*> m_Layers;
     unsigned int m_LayerInsertIndex = 0;
+    std::vector<LayerUpdateWave> m_UpdateWaves;
+    bool m_UpdateWavesDirty = true;
 };
 } // namespace Hazel
\ No newline at end of file
@@ -7,14 +7,48 @@ namespace Hazel
 std::shared_ptr<spdlog::logger> Log::s_CoreLogger;
 std::shared_ptr<spdlog::logger> Log::s_ClientLogger;
 
-void Log::Init()
+static std::shared_ptr<AsyncLogSink> s_AsyncSink;
+
+void Log::Init(const LogSpecification& specification)
+{
+    std::shared_ptr<spdlog::sinks::sink> sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+    if (specification.Async)
+    {
+        s_AsyncSink =
+            std::make_shared<AsyncLogSink>(sink, specification.QueueCapacity, specification.OverflowPolicy);
+        sink = s_AsyncSink;
+    }
+
+    sink->set_pattern("%^[%T] %n: %v%$");
+    const auto level = static_cast<spdlog::level::level_enum>(HZ_LOG_LEVEL);
+
+    s_CoreLogger = std::make_shared<spdlog::logger>("HAZEL", sink);
+    s_CoreLogger->set_level(level);
+    // NOTE: Drains the queue so an error is on screen before an assert breaks into the debugger
+    s_CoreLogger->flush_on(spdlog::level::err);
+    spdlog::register_logger(s_CoreLogger);
+
+    s_ClientLogger = std::make_shared<spdlog::logger>("APP", sink);
+    s_ClientLogger->set_level(level);
+    s_ClientLogger->flush_on(spdlog::level::err);
+    spdlog::register_logger(s_ClientLogger);
+}
+
+void Log::Shutdown()
 {
-    spdlog::set_pattern("%^[%T] %n: %v%$");
+    // NOTE: Writes out whatever is still queued while the loggers are alive
+    if (s_AsyncSink)
+        s_AsyncSink->flush();
 
-    s_CoreLogger = spdlog::stdout_color_mt("HAZEL");
-    s_CoreLogger->set_level(spdlog::level::trace);
+    spdlog::drop_all();
+    s_CoreLogger.reset();
+    s_ClientLogger.reset();
+    s_AsyncSink.reset();
+}
 
-    s_ClientLogger = spdlog::stdout_color_mt("APP");
-    s_ClientLogger->set_level(spdlog::level::trace);
+uint64_t Log::GetDroppedMessageCount()
+{
+    return s_AsyncSink ? s_AsyncSink->GetDroppedCount() : 0;
 }
+
 } // namespace Hazel
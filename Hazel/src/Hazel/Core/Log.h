@@ -6,13 +6,43 @@
 #include "spdlog/sinks/stdout_color_sinks.h"
 #include "spdlog/fmt/ostr.h"
 
+#include "Hazel/Core/AsyncLogSink.h"
+
+// NOTE: Lowest level whose macros are compiled in; anything below expands to nothing and its arguments are never
+// evaluated. Values match spdlog::level. Dist keeps warnings and up unless the build overrides it.
+#define HZ_LOG_LEVEL_TRACE 0
+#define HZ_LOG_LEVEL_DEBUG 1
+#define HZ_LOG_LEVEL_INFO 2
+#define HZ_LOG_LEVEL_WARN 3
+#define HZ_LOG_LEVEL_ERROR 4
+#define HZ_LOG_LEVEL_CRITICAL 5
+#define HZ_LOG_LEVEL_OFF 6
+
+#ifndef HZ_LOG_LEVEL
+#if defined(HZ_DIST)
+#define HZ_LOG_LEVEL HZ_LOG_LEVEL_WARN
+#else
+#define HZ_LOG_LEVEL HZ_LOG_LEVEL_TRACE
+#endif
+#endif
+
 namespace Hazel
 {
 
+struct LogSpecification
+{
+    // NOTE: Formats on the calling thread but hands console output to a background thread; see AsyncLogSink
+    bool Async = true;
+    uint32_t QueueCapacity = 4096; // NOTE: Messages; rounded up to a power of two
+    LogOverflowPolicy OverflowPolicy = LogOverflowPolicy::Drop;
+};
+
 class Log
 {
 public:
-    static void Init();
+    static void Init(const LogSpecification& specification = LogSpecification());
+    // NOTE: Writes out everything still queued. Logging after this is an error.
+    static void Shutdown();
 
     inline static std::shared_ptr<spdlog::logger>& GetCoreLogger()
     {
@@ -23,22 +53,54 @@ public:
         return s_ClientLogger;
     }
 
+    // NOTE: Messages lost to a full queue under LogOverflowPolicy::Drop
+    static uint64_t GetDroppedMessageCount();
+
 private:
     static std::shared_ptr<spdlog::logger> s_CoreLogger;
     static std::shared_ptr<spdlog::logger> s_ClientLogger;
 };
 } // namespace Hazel
 
+#define HZ_LOG_DISCARD(...) ((void)0)
+
 // Core log macros
+#if HZ_LOG_LEVEL <= HZ_LOG_LEVEL_TRACE
 #define HZ_CORE_TRACE(...) ::Hazel::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define HZ_CORE_INFO(...) ::Hazel::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define HZ_CORE_WARN(...) ::Hazel::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define HZ_CORE_ERROR(...) ::Hazel::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define HZ_CORE_FATAL(...) ::Hazel::Log::GetCoreLogger()->fatal(__VA_ARGS__)
-
-// Client log macros
 #define HZ_TRACE(...) ::Hazel::Log::GetClientLogger()->trace(__VA_ARGS__)
+#else
+#define HZ_CORE_TRACE(...) HZ_LOG_DISCARD(__VA_ARGS__)
+#define HZ_TRACE(...) HZ_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if HZ_LOG_LEVEL <= HZ_LOG_LEVEL_INFO
+#define HZ_CORE_INFO(...) ::Hazel::Log::GetCoreLogger()->info(__VA_ARGS__)
 #define HZ_INFO(...) ::Hazel::Log::GetClientLogger()->info(__VA_ARGS__)
+#else
+#define HZ_CORE_INFO(...) HZ_LOG_DISCARD(__VA_ARGS__)
+#define HZ_INFO(...) HZ_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if HZ_LOG_LEVEL <= HZ_LOG_LEVEL_WARN
+#define HZ_CORE_WARN(...) ::Hazel::Log::GetCoreLogger()->warn(__VA_ARGS__)
 #define HZ_WARN(...) ::Hazel::Log::GetClientLogger()->warn(__VA_ARGS__)
+#else
+#define HZ_CORE_WARN(...) HZ_LOG_DISCARD(__VA_ARGS__)
+#define HZ_WARN(...) HZ_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if HZ_LOG_LEVEL <= HZ_LOG_LEVEL_ERROR
+#define HZ_CORE_ERROR(...) ::Hazel::Log::GetCoreLogger()->error(__VA_ARGS__)
 #define HZ_ERROR(...) ::Hazel::Log::GetClientLogger()->error(__VA_ARGS__)
-#define HZ_FATAL(...) ::Hazel::Log::GetClientLogger()->fatal(__VA_ARGS__)
+#else
+#define HZ_CORE_ERROR(...) HZ_LOG_DISCARD(__VA_ARGS__)
+#define HZ_ERROR(...) HZ_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if HZ_LOG_LEVEL <= HZ_LOG_LEVEL_CRITICAL
+#define HZ_CORE_FATAL(...) ::Hazel::Log::GetCoreLogger()->critical(__VA_ARGS__)
+#define HZ_FATAL(...) ::Hazel::Log::GetClientLogger()->critical(__VA_ARGS__)
+#else
+#define HZ_CORE_FATAL(...) HZ_LOG_DISCARD(__VA_ARGS__)
+#define HZ_FATAL(...) HZ_LOG_DISCARD(__VA_ARGS__)
+#endif
@@ -0,0 +1,46 @@
+#include "hzpch.h"
+#include "Time.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Hazel
+{
+
+using Clock = std::chrono::steady_clock;
+
+uint64_t Time::GetNanoseconds()
+{
+    // NOTE: Not glfwGetTime, which needs glfwInit and headless runs never initialize GLFW
+    static const Clock::time_point start = Clock::now();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+
+double Time::GetSeconds()
+{
+    return static_cast<double>(GetNanoseconds()) * 1e-9;
+}
+
+FixedStepAccumulator::FixedStepAccumulator(uint64_t stepNanoseconds, uint32_t maxStepsPerFrame)
+    : m_Step(stepNanoseconds), m_MaxStepsPerFrame(std::max(maxStepsPerFrame, 1u))
+{
+}
+
+uint32_t FixedStepAccumulator::Advance(uint64_t elapsedNanoseconds)
+{
+    if (!m_Step)
+        return 0;
+
+    m_Accumulated += elapsedNanoseconds;
+    const uint64_t steps = m_Accumulated / m_Step;
+    if (steps > m_MaxStepsPerFrame)
+    {
+        m_Accumulated %= m_Step;
+        return m_MaxStepsPerFrame;
+    }
+
+    m_Accumulated -= steps * m_Step;
+    return static_cast<uint32_t>(steps);
+}
+
+} // namespace Hazel
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Hazel/Core/Timestep.h"
+
+#include <cstdint>
+
+namespace Hazel
+{
+
+// NOTE: Monotonic clock counted in integer nanoseconds from the first call, so differences stay exact no matter
+// how long the process runs. Convert to floating point only after subtracting.
+class Time
+{
+public:
+    static uint64_t GetNanoseconds();
+    static double GetSeconds();
+
+    static inline Timestep ToTimestep(uint64_t nanoseconds)
+    {
+        return Timestep(static_cast<float>(static_cast<double>(nanoseconds) * 1e-9));
+    }
+};
+
+// NOTE: Turns variable frame times into a whole number of fixed steps. Time that does not fill a step carries
+// over to the next frame; GetAlpha is how far into the next step it reaches, for interpolating rendered state.
+// At most maxStepsPerFrame steps are taken per frame and time beyond that is dropped, so a frame that ran long
+// cannot make the next one longer still.
+class FixedStepAccumulator
+{
+public:
+    FixedStepAccumulator(uint64_t stepNanoseconds = 0, uint32_t maxStepsPerFrame = 8);
+
+    // NOTE: Returns the number of fixed steps to run for elapsedNanoseconds of frame time; always 0 when disabled
+    uint32_t Advance(uint64_t elapsedNanoseconds);
+
+    inline bool IsEnabled() const
+    {
+        return m_Step != 0;
+    }
+    inline Timestep GetStep() const
+    {
+        return Time::ToTimestep(m_Step);
+    }
+    inline uint64_t GetStepNanoseconds() const
+    {
+        return m_Step;
+    }
+    inline float GetAlpha() const
+    {
+        return m_Step ? static_cast<float>(static_cast<double>(m_Accumulated) / static_cast<double>(m_Step)) : 0.0f;
+    }
+
+private:
+    uint64_t m_Step;
+    uint32_t m_MaxStepsPerFrame;
+    uint64_t m_Accumulated = 0;
+};
+
+} // namespace Hazel
@@ -13,6 +13,10 @@ struct WindowProps
     std::string Title;
     unsigned int Width;
     unsigned int Height;
+    // NOTE: Hands the graphics context to a dedicated render thread instead of keeping it on this one
+    bool ThreadedRendering = false;
+    // NOTE: No OS window or context; see NullWindow
+    bool Headless = false;
 
     WindowProps(const std::string& title = "Hazel Engine", unsigned int width = 1600, unsigned int height = 900)
         : Title(title), Width(width), Height(height)
@@ -26,6 +30,11 @@ public:
     using EventCallbackFn = std::function<void(Event&)>;
 
     virtual void OnUpdate() = 0;
+    // NOTE: Blocks until the window has events, or for at most timeoutSeconds, then delivers them to the event
+    // callback. Unlike OnUpdate it presents nothing.
+    virtual void WaitEvents(double timeoutSeconds) = 0;
+    // NOTE: Makes a WaitEvents in progress return right away; safe to call from any thread
+    virtual void Wake() = 0;
 
     virtual unsigned int GetWidth() const = 0;
     virtual unsigned int GetHeight() const = 0;
@@ -0,0 +1,496 @@
+#include "hzpch.h"
+#include "AllocationTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if HZ_TRACK_MEMORY && !defined(HZ_PLATFORM_WINDOWS) && (defined(__GNUC__) || defined(__clang__))
+#include <execinfo.h>
+#define HZ_HAS_BACKTRACE 1
+#else
+#define HZ_HAS_BACKTRACE 0
+#endif
+
+namespace Hazel
+{
+
+// NOTE: Everything here is reached from operator new, possibly before any constructor has run, so all state
+// is constant-initialized and nothing in the tracking path may allocate.
+namespace
+{
+struct Counter
+{
+    std::atomic<uint64_t> Value{0};
+
+    void Add(uint64_t amount)
+    {
+        Value.fetch_add(amount, std::memory_order_relaxed);
+    }
+    uint64_t Load() const
+    {
+        return Value.load(std::memory_order_relaxed);
+    }
+};
+
+struct TagCounters
+{
+    std::atomic<const char*> Name{nullptr};
+    Counter Allocations;
+    Counter Bytes;
+    std::atomic<int64_t> LiveBytes{0};
+    Counter FrameAllocations;
+    Counter FrameBytes;
+    Counter LastFrameAllocations;
+    Counter LastFrameBytes;
+};
+
+struct StackEntry
+{
+    uint64_t Hash;
+    uint32_t Depth;
+    void* Frames[AllocationTracker::MaxStackFrames];
+    uint64_t Allocations;
+    uint64_t Bytes;
+};
+
+class SpinLock
+{
+public:
+    void Lock()
+    {
+        while (m_Flag.test_and_set(std::memory_order_acquire))
+            ;
+    }
+    void Unlock()
+    {
+        m_Flag.clear(std::memory_order_release);
+    }
+
+private:
+    std::atomic_flag m_Flag = ATOMIC_FLAG_INIT;
+};
+} // namespace
+
+static Counter s_Allocations;
+static Counter s_Frees;
+static Counter s_Bytes;
+static std::atomic<int64_t> s_LiveAllocations{0};
+static std::atomic<int64_t> s_LiveBytes{0};
+static std::atomic<int64_t> s_PeakBytes{0};
+static Counter s_FrameAllocations;
+static Counter s_FrameBytes;
+static Counter s_LastFrameAllocations;
+static Counter s_LastFrameBytes;
+
+static TagCounters s_Tags[AllocationTracker::MaxTags];
+static std::atomic<uint32_t> s_TagCount{1}; // NOTE: Tag 0 is "Untagged"
+static SpinLock s_TagLock;
+
+static constexpr uint32_t s_StackTableSize = 4096;
+static StackEntry s_Stacks[s_StackTableSize];
+static SpinLock s_StackLock;
+static std::atomic<bool> s_StackCapture{false};
+
+static thread_local uint8_t s_CurrentTag = 0;
+static thread_local bool s_InHook = false;
+
+static uint64_t ToUnsigned(int64_t value)
+{
+    return value > 0 ? static_cast<uint64_t>(value) : 0;
+}
+
+uint8_t AllocationTracker::RegisterTag(const char* name)
+{
+    s_TagLock.Lock();
+
+    const uint32_t count = s_TagCount.load(std::memory_order_relaxed);
+    for (uint32_t i = 1; i < count; i++)
+    {
+        const char* existing = s_Tags[i].Name.load(std::memory_order_relaxed);
+        if (existing == name || std::strcmp(existing, name) == 0)
+        {
+            s_TagLock.Unlock();
+            return static_cast<uint8_t>(i);
+        }
+    }
+
+    uint32_t tag = MaxTags - 1;
+    if (count < MaxTags)
+    {
+        tag = count;
+        s_Tags[tag].Name.store(name, std::memory_order_relaxed);
+        s_TagCount.store(count + 1, std::memory_order_release);
+    }
+
+    s_TagLock.Unlock();
+    return static_cast<uint8_t>(tag);
+}
+
+uint8_t AllocationTracker::GetCurrentTag()
+{
+    return s_CurrentTag;
+}
+
+void AllocationTracker::SetCurrentTag(uint8_t tag)
+{
+    s_CurrentTag = tag < MaxTags ? tag : 0;
+}
+
+void AllocationTracker::OnAllocate(size_t size, uint8_t tag)
+{
+    s_Allocations.Add(1);
+    s_Bytes.Add(size);
+    s_FrameAllocations.Add(1);
+    s_FrameBytes.Add(size);
+    s_LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    const int64_t live = s_LiveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) +
+                         static_cast<int64_t>(size);
+    int64_t peak = s_PeakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !s_PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+        ;
+
+    TagCounters& counters = s_Tags[tag < MaxTags ? tag : 0];
+    counters.Allocations.Add(1);
+    counters.Bytes.Add(size);
+    counters.FrameAllocations.Add(1);
+    counters.FrameBytes.Add(size);
+    counters.LiveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+}
+
+void AllocationTracker::OnFree(size_t size, uint8_t tag)
+{
+    s_Frees.Add(1);
+    s_LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+    s_LiveBytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+    s_Tags[tag < MaxTags ? tag : 0].LiveBytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+}
+
+// NOTE: Moves the running frame count into the reported one
+static void RollFrame(Counter& frame, Counter& last)
+{
+    last.Value.store(frame.Value.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void AllocationTracker::BeginFrame()
+{
+    RollFrame(s_FrameAllocations, s_LastFrameAllocations);
+    RollFrame(s_FrameBytes, s_LastFrameBytes);
+
+    for (TagCounters& counters : s_Tags)
+    {
+        RollFrame(counters.FrameAllocations, counters.LastFrameAllocations);
+        RollFrame(counters.FrameBytes, counters.LastFrameBytes);
+    }
+}
+
+AllocationStatistics AllocationTracker::GetStatistics()
+{
+    AllocationStatistics stats;
+    stats.Allocations = s_Allocations.Load();
+    stats.Frees = s_Frees.Load();
+    stats.Bytes = s_Bytes.Load();
+    stats.LiveAllocations = ToUnsigned(s_LiveAllocations.load(std::memory_order_relaxed));
+    stats.LiveBytes = ToUnsigned(s_LiveBytes.load(std::memory_order_relaxed));
+    stats.PeakBytes = ToUnsigned(s_PeakBytes.load(std::memory_order_relaxed));
+    stats.FrameAllocations = s_LastFrameAllocations.Load();
+    stats.FrameBytes = s_LastFrameBytes.Load();
+    return stats;
+}
+
+std::vector<AllocationTagStatistics> AllocationTracker::GetTagStatistics()
+{
+    const uint32_t count = s_TagCount.load(std::memory_order_acquire);
+
+    std::vector<AllocationTagStatistics> result(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const TagCounters& counters = s_Tags[i];
+        AllocationTagStatistics& stats = result[i];
+        stats.Name = i == 0 ? "Untagged" : counters.Name.load(std::memory_order_relaxed);
+        stats.Allocations = counters.Allocations.Load();
+        stats.Bytes = counters.Bytes.Load();
+        stats.LiveBytes = ToUnsigned(counters.LiveBytes.load(std::memory_order_relaxed));
+        stats.FrameAllocations = counters.LastFrameAllocations.Load();
+        stats.FrameBytes = counters.LastFrameBytes.Load();
+    }
+
+    return result;
+}
+
+void AllocationTracker::SetStackCapture(bool enabled)
+{
+    s_StackCapture.store(enabled && IsEnabled(), std::memory_order_relaxed);
+}
+
+bool AllocationTracker::IsStackCaptureEnabled()
+{
+    return s_StackCapture.load(std::memory_order_relaxed);
+}
+
+#if HZ_TRACK_MEMORY
+// NOTE: Skips the tracker's own frames; when the compiler inlines them, operator new shows up as the innermost frame
+static uint32_t CaptureStack(void** frames)
+{
+#if HZ_HAS_BACKTRACE
+    constexpr uint32_t skip = 2;
+    void* captured[AllocationTracker::MaxStackFrames + skip];
+    const int depth = backtrace(captured, AllocationTracker::MaxStackFrames + skip);
+    const uint32_t count = depth > static_cast<int>(skip) ? static_cast<uint32_t>(depth) - skip : 0;
+    std::memcpy(frames, captured + skip, count * sizeof(void*));
+    return count;
+#elif defined(HZ_PLATFORM_WINDOWS)
+    constexpr uint32_t skip = 2;
+    return CaptureStackBackTrace(skip, AllocationTracker::MaxStackFrames, frames, nullptr);
+#else
+    (void)frames;
+    return 0;
+#endif
+}
+
+static void RecordStack(size_t size)
+{
+    void* frames[AllocationTracker::MaxStackFrames];
+    const uint32_t depth = CaptureStack(frames);
+    if (depth == 0)
+        return;
+
+    // NOTE: FNV-1a over the return addresses; 0 marks an empty slot
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t i = 0; i < depth; i++)
+    {
+        hash ^= reinterpret_cast<uintptr_t>(frames[i]);
+        hash *= 1099511628211ull;
+    }
+    hash = hash ? hash : 1;
+
+    s_StackLock.Lock();
+    for (uint32_t probe = 0; probe < s_StackTableSize; probe++)
+    {
+        StackEntry& entry = s_Stacks[(hash + probe) & (s_StackTableSize - 1)];
+        if (entry.Hash == 0)
+        {
+            entry.Hash = hash;
+            entry.Depth = depth;
+            std::memcpy(entry.Frames, frames, depth * sizeof(void*));
+        }
+
+        if (entry.Hash == hash)
+        {
+            entry.Allocations++;
+            entry.Bytes += size;
+            break;
+        }
+    }
+    // NOTE: A full table drops new stacks; the counts of the ones already in it keep growing
+    s_StackLock.Unlock();
+}
+#endif
+
+std::vector<AllocationStack> AllocationTracker::GetTopStacks(uint32_t count)
+{
+    // NOTE: The vectors below allocate; keep those allocations out of the table we are reading
+    const bool inHook = s_InHook;
+    s_InHook = true;
+
+    std::vector<StackEntry> entries;
+    entries.reserve(s_StackTableSize);
+
+    s_StackLock.Lock();
+    for (const StackEntry& entry : s_Stacks)
+    {
+        if (entry.Hash != 0)
+            entries.push_back(entry);
+    }
+    s_StackLock.Unlock();
+
+    std::sort(entries.begin(), entries.end(),
+              [](const StackEntry& a, const StackEntry& b) { return a.Allocations > b.Allocations; });
+    entries.resize(std::min<size_t>(entries.size(), count));
+
+    std::vector<AllocationStack> result;
+    for (const StackEntry& entry : entries)
+    {
+        AllocationStack stack;
+        stack.Allocations = entry.Allocations;
+        stack.Bytes = entry.Bytes;
+
+#if HZ_HAS_BACKTRACE
+        char** symbols = backtrace_symbols(entry.Frames, static_cast<int>(entry.Depth));
+        for (uint32_t i = 0; i < entry.Depth; i++)
+            stack.Frames.push_back(symbols ? symbols[i] : "?");
+        std::free(symbols);
+#else
+        for (uint32_t i = 0; i < entry.Depth; i++)
+        {
+            std::stringstream frame;
+            frame << entry.Frames[i];
+            stack.Frames.push_back(frame.str());
+        }
+#endif
+        result.push_back(std::move(stack));
+    }
+
+    s_InHook = inHook;
+    return result;
+}
+
+void AllocationTracker::ResetStacks()
+{
+    s_StackLock.Lock();
+    std::memset(static_cast<void*>(s_Stacks), 0, sizeof(s_Stacks));
+    s_StackLock.Unlock();
+}
+
+#if HZ_TRACK_MEMORY
+
+namespace
+{
+// NOTE: Sits directly in front of every tracked block, so a free knows what it is giving back
+struct AllocationHeader
+{
+    uint64_t Size;
+    uint32_t Offset; // NOTE: From the start of the malloc'd block to the user pointer
+    uint8_t Tag;
+    uint8_t Padding[3];
+};
+static_assert(sizeof(AllocationHeader) == 16, "Header must keep the user pointer 16-byte aligned");
+} // namespace
+
+static void* TrackedAllocate(size_t size, size_t alignment) noexcept
+{
+    const size_t extra = alignment > sizeof(AllocationHeader) ? alignment : 0;
+    uint8_t* raw = static_cast<uint8_t*>(std::malloc(size + sizeof(AllocationHeader) + extra));
+    if (!raw)
+        return nullptr;
+
+    uintptr_t user = reinterpret_cast<uintptr_t>(raw) + sizeof(AllocationHeader);
+    if (extra)
+        user = (user + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(user) - 1;
+    header->Size = size;
+    header->Offset = static_cast<uint32_t>(user - reinterpret_cast<uintptr_t>(raw));
+    header->Tag = s_CurrentTag;
+
+    AllocationTracker::OnAllocate(size, header->Tag);
+    if (!s_InHook && s_StackCapture.load(std::memory_order_relaxed))
+    {
+        s_InHook = true;
+        RecordStack(size);
+        s_InHook = false;
+    }
+
+    return reinterpret_cast<void*>(user);
+}
+
+static void TrackedFree(void* pointer) noexcept
+{
+    if (!pointer)
+        return;
+
+    const AllocationHeader* header = static_cast<const AllocationHeader*>(pointer) - 1;
+    AllocationTracker::OnFree(header->Size, header->Tag);
+    std::free(static_cast<uint8_t*>(pointer) - header->Offset);
+}
+
+static void* TrackedAllocateOrThrow(size_t size, size_t alignment)
+{
+    void* pointer = TrackedAllocate(size, alignment);
+    if (!pointer)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+} // namespace Hazel
+
+// NOTE: Replacing these is what HZ_TRACK_MEMORY opts into. Every form routes to the same pair of functions.
+void* operator new(size_t size)
+{
+    return Hazel::TrackedAllocateOrThrow(size, 0);
+}
+void* operator new[](size_t size)
+{
+    return Hazel::TrackedAllocateOrThrow(size, 0);
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return Hazel::TrackedAllocate(size, 0);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return Hazel::TrackedAllocate(size, 0);
+}
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    return Hazel::TrackedAllocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    return Hazel::TrackedAllocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Hazel::TrackedAllocate(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Hazel::TrackedAllocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete[](void* pointer) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete(void* pointer, size_t) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete[](void* pointer, size_t) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    Hazel::TrackedFree(pointer);
+}
+
+#else
+
+} // namespace Hazel
+
+#endif
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// NOTE: Build with HZ_TRACK_MEMORY=1 (premake5 --track-memory) to replace the global operator new/delete with
+// counting versions. Otherwise nothing is hooked, the counters stay at zero and HZ_MEMORY_SCOPE compiles away.
+#ifndef HZ_TRACK_MEMORY
+#define HZ_TRACK_MEMORY 0
+#endif
+
+namespace Hazel
+{
+
+struct AllocationStatistics
+{
+    uint64_t Allocations = 0; // NOTE: Since startup
+    uint64_t Frees = 0;
+    uint64_t Bytes = 0;
+    uint64_t LiveAllocations = 0;
+    uint64_t LiveBytes = 0;
+    uint64_t PeakBytes = 0; // NOTE: Highest LiveBytes seen
+
+    // NOTE: Between the last two BeginFrame calls
+    uint64_t FrameAllocations = 0;
+    uint64_t FrameBytes = 0;
+};
+
+struct AllocationTagStatistics
+{
+    const char* Name = nullptr;
+    uint64_t Allocations = 0;
+    uint64_t Bytes = 0;
+    uint64_t LiveBytes = 0;
+    uint64_t FrameAllocations = 0;
+    uint64_t FrameBytes = 0;
+};
+
+struct AllocationStack
+{
+    uint64_t Allocations = 0;
+    uint64_t Bytes = 0;
+    std::vector<std::string> Frames; // NOTE: Innermost first; symbol names where the platform provides them
+};
+
+// NOTE: Allocations are attributed to the tag of the innermost HZ_MEMORY_SCOPE on the allocating thread, or
+// to "Untagged" outside of any scope. Frees are charged back to the tag that made the allocation.
+//
+// Counters are relaxed atomics, so the numbers are exact once the threads that allocate have gone quiet and
+// approximate while they are running.
+class AllocationTracker
+{
+public:
+    static constexpr uint32_t MaxTags = 32;
+    static constexpr uint32_t MaxStackFrames = 16;
+
+    static constexpr bool IsEnabled()
+    {
+        return HZ_TRACK_MEMORY != 0;
+    }
+
+    // NOTE: Returns the same index for the same name; tags past MaxTags share the last slot
+    static uint8_t RegisterTag(const char* name);
+
+    // NOTE: Called once per frame by Application::Run; the counts since the previous call become the
+    // Frame* values of GetStatistics and GetTagStatistics
+    static void BeginFrame();
+
+    static AllocationStatistics GetStatistics();
+    static std::vector<AllocationTagStatistics> GetTagStatistics();
+
+    // NOTE: Off by default. While on, every allocation walks the stack, so expect frames to slow down.
+    static void SetStackCapture(bool enabled);
+    static bool IsStackCaptureEnabled();
+    // NOTE: Call stacks sorted by allocation count, most first
+    static std::vector<AllocationStack> GetTopStacks(uint32_t count);
+    static void ResetStacks();
+
+    // NOTE: Called by the operator new/delete hooks. Exposed so the counters can be tested without them.
+    static void OnAllocate(size_t size, uint8_t tag);
+    static void OnFree(size_t size, uint8_t tag);
+
+    static uint8_t GetCurrentTag();
+    static void SetCurrentTag(uint8_t tag);
+};
+
+class MemoryScope
+{
+public:
+    MemoryScope(uint8_t tag) : m_PreviousTag(AllocationTracker::GetCurrentTag())
+    {
+        AllocationTracker::SetCurrentTag(tag);
+    }
+
+    ~MemoryScope()
+    {
+        AllocationTracker::SetCurrentTag(m_PreviousTag);
+    }
+
+    MemoryScope(const MemoryScope&) = delete;
+    MemoryScope& operator=(const MemoryScope&) = delete;
+
+private:
+    uint8_t m_PreviousTag;
+};
+
+} // namespace Hazel
+
+#if HZ_TRACK_MEMORY
+#define HZ_MEMORY_CONCAT_IMPL(a, b) a##b
+#define HZ_MEMORY_CONCAT(a, b) HZ_MEMORY_CONCAT_IMPL(a, b)
+
+// NOTE: name must be a string literal; the tag is looked up once per call site
+#define HZ_MEMORY_SCOPE(name)                                                                                          \
+    static const uint8_t HZ_MEMORY_CONCAT(memoryTag, __LINE__) = ::Hazel::AllocationTracker::RegisterTag(name);        \
+    ::Hazel::MemoryScope HZ_MEMORY_CONCAT(memoryScope, __LINE__)(HZ_MEMORY_CONCAT(memoryTag, __LINE__))
+#else
+#define HZ_MEMORY_SCOPE(name)
+#endif
@@ -0,0 +1,206 @@
+#include "hzpch.h"
+#include "Instrumentor.h"
+
+#include <condition_variable>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
+namespace Hazel
+{
+
+// NOTE: Single producer (the owning thread), single consumer (the writer thread)
+struct ProfileThreadBuffer
+{
+    static constexpr uint32_t Capacity = 1 << 14;
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    std::unique_ptr<ProfileEvent[]> Events{new ProfileEvent[Capacity]};
+    std::atomic<uint32_t> Head{0};
+    std::atomic<uint32_t> Tail{0};
+    std::atomic<uint32_t> Dropped{0};
+    uint32_t ThreadID = 0;
+
+    void Push(const ProfileEvent& event)
+    {
+        const uint32_t head = Head.load(std::memory_order_relaxed);
+        if (head - Tail.load(std::memory_order_acquire) == Capacity)
+        {
+            Dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        Events[head & (Capacity - 1)] = event;
+        Head.store(head + 1, std::memory_order_release);
+    }
+
+    template <typename FuncT> void Drain(FuncT&& func)
+    {
+        uint32_t tail = Tail.load(std::memory_order_relaxed);
+        const uint32_t head = Head.load(std::memory_order_acquire);
+        for (; tail != head; tail++)
+            func(Events[tail & (Capacity - 1)]);
+        Tail.store(tail, std::memory_order_release);
+    }
+};
+
+struct InstrumentorData
+{
+    // NOTE: Buffers are never freed while the process runs; a thread may record until the moment it exits
+    std::mutex BuffersMutex;
+    std::vector<std::unique_ptr<ProfileThreadBuffer>> Buffers;
+
+    std::mutex SessionMutex;
+    std::condition_variable WakeWriter;
+    bool StopWriter = false;
+    std::thread Writer;
+
+    std::ofstream Output;
+    uint64_t SessionStart = 0;
+    uint64_t EventCount = 0;
+};
+
+static constexpr auto s_WriterInterval = std::chrono::milliseconds(100);
+
+std::atomic<bool> Instrumentor::s_SessionActive{false};
+
+static InstrumentorData& GetData()
+{
+    static InstrumentorData data;
+    return data;
+}
+
+static ProfileThreadBuffer& GetThreadBuffer()
+{
+    thread_local ProfileThreadBuffer* buffer = nullptr;
+    if (!buffer)
+    {
+        InstrumentorData& data = GetData();
+        std::lock_guard<std::mutex> lock(data.BuffersMutex);
+        data.Buffers.push_back(std::make_unique<ProfileThreadBuffer>());
+        buffer = data.Buffers.back().get();
+        buffer->ThreadID = static_cast<uint32_t>(data.Buffers.size());
+    }
+
+    return *buffer;
+}
+
+static void WriteEscaped(std::ostream& stream, const char* text)
+{
+    for (; *text; text++)
+    {
+        if (*text == '"' || *text == '\\')
+            stream << '\\';
+        stream << *text;
+    }
+}
+
+// NOTE: Writer thread only (and EndSession once the writer has stopped)
+static void DrainBuffers(InstrumentorData& data)
+{
+    std::vector<ProfileThreadBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(data.BuffersMutex);
+        for (auto& buffer : data.Buffers)
+            buffers.push_back(buffer.get());
+    }
+
+    std::ostream& out = data.Output;
+    for (ProfileThreadBuffer* buffer : buffers)
+    {
+        const uint32_t threadID = buffer->ThreadID;
+        buffer->Drain([&](const ProfileEvent& event) {
+            // NOTE: Left over from before this session began
+            if (event.Start < data.SessionStart)
+                return;
+
+            out << (data.EventCount++ ? ",\n" : "\n");
+            out << R"({"cat":"function","ph":"X","pid":0,"tid":)" << threadID << R"(,"name":")";
+            WriteEscaped(out, event.Name);
+            out << R"(","ts":)" << (event.Start - data.SessionStart) / 1000 << '.' << std::setfill('0')
+                << std::setw(3) << (event.Start - data.SessionStart) % 1000 << R"(,"dur":)" << event.Duration / 1000
+                << '.' << std::setw(3) << event.Duration % 1000 << '}';
+        });
+    }
+
+    out.flush();
+}
+
+static void WriterLoop()
+{
+    InstrumentorData& data = GetData();
+    std::unique_lock<std::mutex> lock(data.SessionMutex);
+    while (!data.StopWriter)
+    {
+        data.WakeWriter.wait_for(lock, s_WriterInterval);
+        DrainBuffers(data);
+    }
+}
+
+void Instrumentor::BeginSession(const std::string& name, const std::string& filepath)
+{
+    InstrumentorData& data = GetData();
+    if (IsSessionActive())
+        EndSession();
+
+    std::lock_guard<std::mutex> lock(data.SessionMutex);
+    data.Output.open(filepath);
+    if (!data.Output.is_open())
+        return;
+
+    data.SessionStart = Now();
+    data.EventCount = 0;
+    {
+        std::lock_guard<std::mutex> buffersLock(data.BuffersMutex);
+        for (auto& buffer : data.Buffers)
+            buffer->Dropped.store(0, std::memory_order_relaxed);
+    }
+
+    data.Output << R"({"otherData":{"session":")";
+    WriteEscaped(data.Output, name.c_str());
+    data.Output << R"("},"traceEvents":[)";
+    data.Output.flush();
+
+    data.StopWriter = false;
+    data.Writer = std::thread(WriterLoop);
+    s_SessionActive.store(true, std::memory_order_release);
+}
+
+void Instrumentor::EndSession()
+{
+    InstrumentorData& data = GetData();
+    if (!IsSessionActive())
+        return;
+
+    s_SessionActive.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(data.SessionMutex);
+        data.StopWriter = true;
+    }
+    data.WakeWriter.notify_one();
+    data.Writer.join();
+
+    std::lock_guard<std::mutex> lock(data.SessionMutex);
+    DrainBuffers(data);
+    data.Output << "\n]}\n";
+    data.Output.close();
+}
+
+void Instrumentor::Record(const ProfileEvent& event)
+{
+    GetThreadBuffer().Push(event);
+}
+
+uint64_t Instrumentor::GetDroppedEventCount()
+{
+    InstrumentorData& data = GetData();
+    std::lock_guard<std::mutex> lock(data.BuffersMutex);
+
+    uint64_t dropped = 0;
+    for (auto& buffer : data.Buffers)
+        dropped += buffer->Dropped.load(std::memory_order_relaxed);
+    return dropped;
+}
+
+} // namespace Hazel
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// NOTE: Build with HZ_PROFILE=1 (premake5 --profile) to compile the HZ_PROFILE_* macros in; otherwise they
+// expand to nothing and instrumented code pays nothing.
+#ifndef HZ_PROFILE
+#define HZ_PROFILE 0
+#endif
+
+namespace Hazel
+{
+
+// NOTE: One complete ("ph":"X") event of a Chrome/Perfetto trace. Name must outlive the session; the
+// macros only ever pass string literals and function signatures.
+struct ProfileEvent
+{
+    const char* Name;
+    uint64_t Start;    // NOTE: Nanoseconds, steady clock
+    uint64_t Duration; // NOTE: Nanoseconds
+};
+
+// NOTE: Collects scope timings into a trace file. Each thread records into its own fixed-size ring that
+// only it writes and only the writer thread reads, so recording takes no lock. The writer thread drains
+// every ring a few times a second and streams the events to disk. When a ring is full, events are
+// dropped and counted rather than blocking the instrumented thread.
+class Instrumentor
+{
+public:
+    static void BeginSession(const std::string& name, const std::string& filepath = "results.json");
+    static void EndSession();
+
+    inline static bool IsSessionActive()
+    {
+        return s_SessionActive.load(std::memory_order_relaxed);
+    }
+
+    static void Record(const ProfileEvent& event);
+
+    // NOTE: Events lost to full rings since the session began
+    static uint64_t GetDroppedEventCount();
+
+    inline static uint64_t Now()
+    {
+        auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+
+private:
+    static std::atomic<bool> s_SessionActive;
+};
+
+class InstrumentationTimer
+{
+public:
+    InstrumentationTimer(const char* name) : m_Name(name), m_Start(Instrumentor::Now())
+    {
+    }
+
+    ~InstrumentationTimer()
+    {
+        if (Instrumentor::IsSessionActive())
+            Instrumentor::Record({m_Name, m_Start, Instrumentor::Now() - m_Start});
+    }
+
+    InstrumentationTimer(const InstrumentationTimer&) = delete;
+    InstrumentationTimer& operator=(const InstrumentationTimer&) = delete;
+
+private:
+    const char* m_Name;
+    uint64_t m_Start;
+};
+
+} // namespace Hazel
+
+#if HZ_PROFILE
+#if defined(__GNUC__) || defined(__clang__)
+#define HZ_FUNC_SIG __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+#define HZ_FUNC_SIG __FUNCSIG__
+#else
+#define HZ_FUNC_SIG __func__
+#endif
+
+#define HZ_PROFILE_CONCAT_IMPL(a, b) a##b
+#define HZ_PROFILE_CONCAT(a, b) HZ_PROFILE_CONCAT_IMPL(a, b)
+
+#define HZ_PROFILE_BEGIN_SESSION(name, filepath) ::Hazel::Instrumentor::BeginSession(name, filepath)
+#define HZ_PROFILE_END_SESSION() ::Hazel::Instrumentor::EndSession()
+#define HZ_PROFILE_SCOPE(name) ::Hazel::InstrumentationTimer HZ_PROFILE_CONCAT(timer, __LINE__)(name)
+#define HZ_PROFILE_FUNCTION() HZ_PROFILE_SCOPE(HZ_FUNC_SIG)
+#else
+#define HZ_PROFILE_BEGIN_SESSION(name, filepath)
+#define HZ_PROFILE_END_SESSION()
+#define HZ_PROFILE_SCOPE(name)
+#define HZ_PROFILE_FUNCTION()
+#endif
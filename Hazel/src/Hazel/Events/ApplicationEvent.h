@@ -45,6 +45,28 @@ public:
     EVENT_CLASS_CATEGORY(EventCategoryApplication)
 };
 
+class WindowFocusEvent : public Event
+{
+public:
+    WindowFocusEvent()
+    {
+    }
+
+    EVENT_CLASS_TYPE(WindowFocus)
+    EVENT_CLASS_CATEGORY(EventCategoryApplication)
+};
+
+class WindowLostFocusEvent : public Event
+{
+public:
+    WindowLostFocusEvent()
+    {
+    }
+
+    EVENT_CLASS_TYPE(WindowLostFocus)
+    EVENT_CLASS_CATEGORY(EventCategoryApplication)
+};
+
 class AppTickEvent : public Event
 {
 public:
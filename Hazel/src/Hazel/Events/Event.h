@@ -32,7 +32,8 @@ enum EventCategory
     EventCategoryInput = BIT(1),
     EventCategoryKeyboard = BIT(2),
     EventCategoryMouse = BIT(3),
-    EventCategoryMouseButton = BIT(4)
+    EventCategoryMouseButton = BIT(4),
+    EventCategoryAll = ~0
 };
 
 #define EVENT_CLASS_TYPE(type)                                                                                         \
@@ -84,14 +85,14 @@ protected:
 
 class EventDispatcher
 {
-    template <typename T> using EventFn = std::function<bool(T&)>;
-
 public:
     EventDispatcher(Event& event) : m_Event(event)
     {
     }
 
-    template <typename T> bool Dispatch(EventFn<T> func)
+    // NOTE: func is any callable taking T& and returning bool. It is called directly, so lambdas inline and
+    // nothing is wrapped in a std::function.
+    template <typename T, typename F> bool Dispatch(const F& func)
     {
         if (m_Event.GetEventType() == T::GetStaticType())
         {
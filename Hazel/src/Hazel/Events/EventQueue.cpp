@@ -0,0 +1,62 @@
+#include "hzpch.h"
+#include "EventQueue.h"
+
+namespace Hazel
+{
+
+EventQueue::EventQueue(size_t capacity)
+{
+    m_Events.reserve(capacity);
+}
+
+void EventQueue::Push(const Event& event)
+{
+    EventPacket packet;
+    if (!EncodeEvent(event, 0, packet))
+        return;
+
+    if (m_Coalescing && TryCoalesce(packet))
+    {
+        m_CoalescedCount++;
+        return;
+    }
+
+    m_Events.push_back(packet);
+}
+
+void EventQueue::Drain(const std::function<void(Event&)>& callback)
+{
+    // NOTE: Indexed, since the callback may push and reallocate
+    for (m_Dispatched = 0; m_Dispatched < m_Events.size();)
+    {
+        const EventPacket packet = m_Events[m_Dispatched++];
+        DecodeEvent(packet, callback);
+    }
+
+    m_Events.clear();
+    m_Dispatched = 0;
+}
+
+bool EventQueue::TryCoalesce(const EventPacket& packet)
+{
+    // NOTE: Never fold into an event that has already been dispatched
+    if (m_Events.size() <= m_Dispatched || m_Events.back().Type != packet.Type)
+        return false;
+
+    EventPacket& last = m_Events.back();
+    switch (static_cast<EventType>(packet.Type))
+    {
+    case EventType::WindowResize:
+    case EventType::MouseMoved:
+        last.Data = packet.Data;
+        return true;
+    case EventType::MouseScrolled:
+        last.Data.Float[0] += packet.Data.Float[0];
+        last.Data.Float[1] += packet.Data.Float[1];
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace Hazel
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Hazel/Events/EventRecording.h"
+
+#include <functional>
+#include <vector>
+
+namespace Hazel
+{
+
+// NOTE: Collects the events a frame's window callbacks produce as POD packets so they can be dispatched in one
+// pass. The storage is reused from frame to frame; pushing allocates only when a frame outgrows every
+// earlier one.
+//
+// With coalescing on, an event that directly follows one of the same type replaces it (mouse moves, resizes)
+// or adds to it (scrolls). Anything in between, such as a button press, keeps both so the order input
+// arrived in is preserved.
+class EventQueue
+{
+public:
+    EventQueue(size_t capacity = 256);
+
+    void Push(const Event& event);
+    // NOTE: Dispatches the queued events in order and empties the queue. Events pushed by the callback are
+    // dispatched in the same pass.
+    void Drain(const std::function<void(Event&)>& callback);
+
+    inline void SetCoalescing(bool enabled)
+    {
+        m_Coalescing = enabled;
+    }
+    inline bool IsCoalescing() const
+    {
+        return m_Coalescing;
+    }
+
+    inline size_t GetSize() const
+    {
+        return m_Events.size();
+    }
+    // NOTE: Events folded into an earlier one since startup
+    inline uint64_t GetCoalescedCount() const
+    {
+        return m_CoalescedCount;
+    }
+
+private:
+    bool TryCoalesce(const EventPacket& packet);
+
+private:
+    std::vector<EventPacket> m_Events;
+    size_t m_Dispatched = 0;
+    bool m_Coalescing = true;
+    uint64_t m_CoalescedCount = 0;
+};
+
+} // namespace Hazel
@@ -0,0 +1,208 @@
+#include "hzpch.h"
+#include "EventRecording.h"
+
+#include "Hazel/Events/ApplicationEvent.h"
+#include "Hazel/Events/KeyEvent.h"
+#include "Hazel/Events/MouseEvent.h"
+
+#include <cstring>
+
+namespace Hazel
+{
+
+bool EncodeEvent(const Event& event, uint32_t frame, EventPacket& packet)
+{
+    packet = EventPacket();
+    packet.Frame = frame;
+    packet.Type = static_cast<uint16_t>(event.GetEventType());
+
+    switch (event.GetEventType())
+    {
+    case EventType::WindowClose:
+    case EventType::WindowFocus:
+    case EventType::WindowLostFocus:
+        return true;
+    case EventType::WindowResize: {
+        const auto& e = static_cast<const WindowResizeEvent&>(event);
+        packet.Data.Int[0] = static_cast<int32_t>(e.GetWidth());
+        packet.Data.Int[1] = static_cast<int32_t>(e.GetHeight());
+        return true;
+    }
+    case EventType::KeyPressed: {
+        const auto& e = static_cast<const KeyPressedEvent&>(event);
+        packet.Data.Int[0] = e.GetKeyCode();
+        packet.Data.Int[1] = e.GetRepeatCount();
+        return true;
+    }
+    case EventType::KeyReleased:
+    case EventType::KeyTyped:
+        packet.Data.Int[0] = static_cast<const KeyEvent&>(event).GetKeyCode();
+        return true;
+    case EventType::MouseButtonPressed:
+    case EventType::MouseButtonReleased:
+        packet.Data.Int[0] = static_cast<const MouseButtonEvent&>(event).GetMouseButton();
+        return true;
+    case EventType::MouseMoved: {
+        const auto& e = static_cast<const MouseMovedEvent&>(event);
+        packet.Data.Float[0] = e.GetX();
+        packet.Data.Float[1] = e.GetY();
+        return true;
+    }
+    case EventType::MouseScrolled: {
+        const auto& e = static_cast<const MouseScrolledEvent&>(event);
+        packet.Data.Float[0] = e.GetXOffset();
+        packet.Data.Float[1] = e.GetYOffset();
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+bool DecodeEvent(const EventPacket& packet, const std::function<void(Event&)>& callback)
+{
+    switch (static_cast<EventType>(packet.Type))
+    {
+    case EventType::WindowClose: {
+        WindowCloseEvent event;
+        callback(event);
+        return true;
+    }
+    case EventType::WindowFocus: {
+        WindowFocusEvent event;
+        callback(event);
+        return true;
+    }
+    case EventType::WindowLostFocus: {
+        WindowLostFocusEvent event;
+        callback(event);
+        return true;
+    }
+    case EventType::WindowResize: {
+        WindowResizeEvent event(static_cast<unsigned int>(packet.Data.Int[0]),
+                                static_cast<unsigned int>(packet.Data.Int[1]));
+        callback(event);
+        return true;
+    }
+    case EventType::KeyPressed: {
+        KeyPressedEvent event(packet.Data.Int[0], packet.Data.Int[1]);
+        callback(event);
+        return true;
+    }
+    case EventType::KeyReleased: {
+        KeyReleasedEvent event(packet.Data.Int[0]);
+        callback(event);
+        return true;
+    }
+    case EventType::KeyTyped: {
+        KeyTypedEvent event(packet.Data.Int[0]);
+        callback(event);
+        return true;
+    }
+    case EventType::MouseButtonPressed: {
+        MouseButtonPressedEvent event(packet.Data.Int[0]);
+        callback(event);
+        return true;
+    }
+    case EventType::MouseButtonReleased: {
+        MouseButtonReleasedEvent event(packet.Data.Int[0]);
+        callback(event);
+        return true;
+    }
+    case EventType::MouseMoved: {
+        MouseMovedEvent event(packet.Data.Float[0], packet.Data.Float[1]);
+        callback(event);
+        return true;
+    }
+    case EventType::MouseScrolled: {
+        MouseScrolledEvent event(packet.Data.Float[0], packet.Data.Float[1]);
+        callback(event);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+EventRecorder::~EventRecorder()
+{
+    if (m_File)
+        Close(m_Header.FrameCount);
+}
+
+bool EventRecorder::Open(const std::string& filepath, float timestep)
+{
+    if (m_File)
+        Close(m_Header.FrameCount);
+
+    m_File = std::fopen(filepath.c_str(), "wb");
+    if (!m_File)
+        return false;
+
+    m_Header = EventRecordingHeader();
+    m_Header.Timestep = timestep;
+    std::fwrite(&m_Header, sizeof(m_Header), 1, m_File);
+    return true;
+}
+
+void EventRecorder::Close(uint32_t frameCount)
+{
+    if (!m_File)
+        return;
+
+    m_Header.FrameCount = frameCount;
+    std::fseek(m_File, 0, SEEK_SET);
+    std::fwrite(&m_Header, sizeof(m_Header), 1, m_File);
+    std::fclose(m_File);
+    m_File = nullptr;
+}
+
+bool EventRecorder::Record(const Event& event, uint32_t frame)
+{
+    EventPacket packet;
+    if (!m_File || !(event.GetCategoryFlags() & EventCategoryInput) || !EncodeEvent(event, frame, packet))
+        return false;
+
+    // NOTE: Buffered by stdio; a frame's handful of packets costs no system call
+    std::fwrite(&packet, sizeof(packet), 1, m_File);
+    m_Header.FrameCount = frame + 1;
+    return true;
+}
+
+bool EventPlayer::Open(const std::string& filepath)
+{
+    std::FILE* file = std::fopen(filepath.c_str(), "rb");
+    if (!file)
+        return false;
+
+    EventRecordingHeader header;
+    const EventRecordingHeader expected;
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.Magic, expected.Magic, sizeof(header.Magic)) != 0 ||
+        header.Version != EventRecordingHeader::CurrentVersion || header.Timestep <= 0.0f)
+    {
+        std::fclose(file);
+        return false;
+    }
+
+    std::vector<EventPacket> packets;
+    EventPacket packet;
+    while (std::fread(&packet, sizeof(packet), 1, file) == 1)
+        packets.push_back(packet);
+    std::fclose(file);
+
+    m_Header = header;
+    m_Packets = std::move(packets);
+    m_NextPacket = 0;
+    return true;
+}
+
+void EventPlayer::Replay(uint32_t frame, const std::function<void(Event&)>& callback)
+{
+    for (; m_NextPacket < m_Packets.size() && m_Packets[m_NextPacket].Frame <= frame; m_NextPacket++)
+    {
+        DecodeEvent(m_Packets[m_NextPacket], callback);
+    }
+}
+
+} // namespace Hazel
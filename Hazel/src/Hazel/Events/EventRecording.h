@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Hazel/Events/Event.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Hazel
+{
+
+// NOTE: A recording is an EventRecordingHeader followed by one EventPacket per input event, in the order the
+// events were dispatched. Both are written as-is, so files are only portable between little-endian machines.
+struct EventRecordingHeader
+{
+    static constexpr uint32_t CurrentVersion = 1;
+
+    char Magic[4] = {'H', 'Z', 'E', 'V'};
+    uint32_t Version = CurrentVersion;
+    float Timestep = 0.0f;   // NOTE: Seconds per frame; replays advance the clock by exactly this much
+    uint32_t FrameCount = 0; // NOTE: Frames that ran while recording; a replay closes the application after these
+};
+
+struct EventPacket
+{
+    uint32_t Frame = 0; // NOTE: The frame whose update first sees the event
+    uint16_t Type = 0;  // NOTE: EventType
+    uint16_t Reserved = 0;
+    union {
+        int32_t Int[2];
+        float Float[2];
+    } Data = {};
+};
+
+static_assert(sizeof(EventRecordingHeader) == 16, "EventRecordingHeader is written to disk as-is");
+static_assert(sizeof(EventPacket) == 16, "EventPacket is written to disk as-is");
+
+// NOTE: Packs an event into a POD packet; false for event types that carry no encoding (the App* events)
+bool EncodeEvent(const Event& event, uint32_t frame, EventPacket& packet);
+// NOTE: Rebuilds the event a packet was encoded from and hands it to callback; false for unknown types
+bool DecodeEvent(const EventPacket& packet, const std::function<void(Event&)>& callback);
+
+class EventRecorder
+{
+public:
+    EventRecorder() = default;
+    ~EventRecorder();
+
+    EventRecorder(const EventRecorder&) = delete;
+    EventRecorder& operator=(const EventRecorder&) = delete;
+
+    bool Open(const std::string& filepath, float timestep);
+    // NOTE: Rewrites the header with the final frame count
+    void Close(uint32_t frameCount);
+
+    // NOTE: Only keyboard and mouse events are recorded; window events come from the window itself and stay
+    // live. Returns false for everything else.
+    bool Record(const Event& event, uint32_t frame);
+
+    inline bool IsOpen() const
+    {
+        return m_File != nullptr;
+    }
+
+private:
+    std::FILE* m_File = nullptr;
+    EventRecordingHeader m_Header;
+};
+
+class EventPlayer
+{
+public:
+    // NOTE: Reads the whole recording up front so replays never touch the disk mid-run
+    bool Open(const std::string& filepath);
+
+    // NOTE: Dispatches every event recorded up to and including frame, in order
+    void Replay(uint32_t frame, const std::function<void(Event&)>& callback);
+
+    inline bool IsFinished(uint32_t frame) const
+    {
+        return frame >= m_Header.FrameCount;
+    }
+    inline float GetTimestep() const
+    {
+        return m_Header.Timestep;
+    }
+    inline uint32_t GetFrameCount() const
+    {
+        return m_Header.FrameCount;
+    }
+
+private:
+    EventRecordingHeader m_Header;
+    std::vector<EventPacket> m_Packets;
+    size_t m_NextPacket = 0;
+};
+
+} // namespace Hazel
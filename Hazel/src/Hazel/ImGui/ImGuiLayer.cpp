@@ -7,6 +7,9 @@
 
 #include "Hazel/Core/Application.h"
 #include "Hazel/Core/Core.h"
+#include "Hazel/Renderer/RenderThread.h"
+
+#include "Platform/OpenGL/OpenGLStateCache.h"
 
 // NOTE: Temporary
 #include "GLFW/glfw3.h"
@@ -14,7 +17,8 @@
 
 namespace Hazel
 {
-ImGuiLayer::ImGuiLayer() : Layer("ImGuiLayer")
+// NOTE: ImGui reads input through its own GLFW callbacks, so no events are delivered here
+ImGuiLayer::ImGuiLayer() : Layer("ImGuiLayer", EventCategory::None)
 {
 }
 
@@ -30,7 +34,9 @@ void ImGuiLayer::OnAttach()
     static_cast<void>(io);
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
     io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
-    io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+    // NOTE: Platform windows need the GL context on the main thread, which the render thread owns
+    if (!RenderThread::IsRunning())
+        io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
 
     ImGui::StyleColorsDark();
 
@@ -53,12 +59,17 @@ void ImGuiLayer::OnAttach()
     ImGui::GetStyle().ScaleAllSizes(scale);
 
     ImGui_ImplGlfw_InitForOpenGL(window, true);
-    ImGui_ImplOpenGL3_Init("#version 410");
+    // NOTE: Device objects are created up front so the render thread never builds the font atlas while the
+    // main thread reads it in NewFrame
+    RenderThread::SubmitAndWait([]() {
+        ImGui_ImplOpenGL3_Init("#version 410");
+        ImGui_ImplOpenGL3_CreateDeviceObjects();
+    });
 }
 
 void ImGuiLayer::OnDetach()
 {
-    ImGui_ImplOpenGL3_Shutdown();
+    RenderThread::SubmitAndWait([]() { ImGui_ImplOpenGL3_Shutdown(); });
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
 }
@@ -71,7 +82,7 @@ void ImGuiLayer::OnImGuiRender()
 
 void ImGuiLayer::Begin()
 {
-    ImGui_ImplOpenGL3_NewFrame();
+    RenderThread::Submit([]() { ImGui_ImplOpenGL3_NewFrame(); });
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
 }
@@ -94,7 +105,27 @@ void ImGuiLayer::End()
 
     // Rendering
     ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    if (RenderThread::IsRecording())
+    {
+        // NOTE: ImGui reuses its draw lists next frame, so the render thread gets its own copy
+        ImDrawData* drawData = IM_NEW(ImDrawData)(*ImGui::GetDrawData());
+        for (int i = 0; i < drawData->CmdListsCount; i++)
+            drawData->CmdLists[i] = drawData->CmdLists[i]->CloneOutput();
+
+        RenderThread::Submit([drawData]() {
+            ImGui_ImplOpenGL3_RenderDrawData(drawData);
+            OpenGLStateCache::Invalidate();
+            for (int i = 0; i < drawData->CmdListsCount; i++)
+                IM_DELETE(drawData->CmdLists[i]);
+            IM_DELETE(drawData);
+        });
+    }
+    else
+    {
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        // NOTE: The backend binds its own program, buffers and textures behind the state cache
+        OpenGLStateCache::Invalidate();
+    }
 
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
     {
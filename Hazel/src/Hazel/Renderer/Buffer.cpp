@@ -2,23 +2,24 @@
 #include "Buffer.h"
 #include "Hazel/Core/Core.h"
 
+#include "RenderThread.h"
 #include "Renderer.h"
 #include "RendererAPI.h"
 
+#include "Platform/Null/NullBuffer.h"
 #include "Platform/OpenGL/OpenGLBuffer.h"
 
 namespace Hazel
 {
-VertexBuffer* VertexBuffer::Create(float* vertices, uint32_t size)
+Ref<VertexBuffer> VertexBuffer::Create(uint32_t size, BufferUsage usage)
 {
     switch (Renderer::GetAPI())
     {
     case RendererAPI::API::None: {
-        HZ_CORE_ASSERT(false, "Renderer API::None is currently not supported!");
-        return nullptr;
+        return RenderThread::CreateResource<NullVertexBuffer>(size, usage);
     }
     case RendererAPI::API::OpenGL: {
-        return new OpenGLVertexBuffer(vertices, size);
+        return RenderThread::CreateResource<OpenGLVertexBuffer>(size, usage);
     }
     }
 
@@ -26,16 +27,47 @@ VertexBuffer* VertexBuffer::Create(float* vertices, uint32_t size)
     return nullptr;
 }
 
-IndexBuffer* IndexBuffer::Create(uint32_t* indices, uint32_t count)
+Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size)
 {
     switch (Renderer::GetAPI())
     {
     case RendererAPI::API::None: {
-        HZ_CORE_ASSERT(false, "Renderer API::None is currently not supported!");
-        return nullptr;
+        return RenderThread::CreateResource<NullVertexBuffer>(vertices, size);
     }
     case RendererAPI::API::OpenGL: {
-        return new OpenGLIndexBuffer(indices, count);
+        return RenderThread::CreateResource<OpenGLVertexBuffer>(vertices, size);
+    }
+    }
+
+    HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+    return nullptr;
+}
+
+Ref<IndexBuffer> IndexBuffer::Create(uint32_t count, BufferUsage usage)
+{
+    switch (Renderer::GetAPI())
+    {
+    case RendererAPI::API::None: {
+        return RenderThread::CreateResource<NullIndexBuffer>(count, usage);
+    }
+    case RendererAPI::API::OpenGL: {
+        return RenderThread::CreateResource<OpenGLIndexBuffer>(count, usage);
+    }
+    }
+
+    HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+    return nullptr;
+}
+
+Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count)
+{
+    switch (Renderer::GetAPI())
+    {
+    case RendererAPI::API::None: {
+        return RenderThread::CreateResource<NullIndexBuffer>(indices, count);
+    }
+    case RendererAPI::API::OpenGL: {
+        return RenderThread::CreateResource<OpenGLIndexBuffer>(indices, count);
     }
     }
 
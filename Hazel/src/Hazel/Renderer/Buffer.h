@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Hazel/Core/Core.h"
+
 namespace Hazel
 {
 
@@ -57,9 +59,12 @@ struct BufferElement
     uint32_t Size;
     uint32_t Offset;
     bool Normalized;
+    // NOTE: Instances drawn per step of this attribute; 0 advances it per vertex
+    uint32_t Divisor;
 
-    BufferElement(ShaderDataType type, const std::string& name, bool normalized = false)
-        : Type(type), Name(name), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized)
+    BufferElement(ShaderDataType type, const std::string& name, bool normalized = false, uint32_t divisor = 0)
+        : Type(type), Name(name), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized),
+          Divisor(divisor)
     {
     }
 
@@ -93,6 +98,34 @@ struct BufferElement
         HZ_CORE_ASSERT(false, "Unknown ShaderDataType!");
         return 0;
     }
+
+    // NOTE: A vertex attribute holds at most 4 components, so matrices take one location per column
+    uint32_t GetLocationCount() const
+    {
+        switch (Type)
+        {
+        case ShaderDataType::Mat3:
+            return 3;
+        case ShaderDataType::Mat4:
+            return 4;
+        default:
+            return 1;
+        }
+    }
+
+    bool IsInteger() const
+    {
+        switch (Type)
+        {
+        case ShaderDataType::Int:
+        case ShaderDataType::Int2:
+        case ShaderDataType::Int3:
+        case ShaderDataType::Int4:
+            return true;
+        default:
+            return false;
+        }
+    }
 };
 
 class BufferLayout
@@ -149,6 +182,17 @@ private:
     uint32_t m_Stride = 0;
 };
 
+// NOTE: How often the contents change.
+//   Static:  uploaded once at creation
+//   Dynamic: partially updated now and then through SetData
+//   Stream:  rewritten every frame; supports Map/Unmap and is backed by a persistently mapped ring where available
+enum class BufferUsage
+{
+    Static = 0,
+    Dynamic,
+    Stream
+};
+
 class VertexBuffer
 {
 public:
@@ -157,10 +201,24 @@ public:
     virtual void Bind() const = 0;
     virtual void Unbind() const = 0;
 
+    // NOTE: Stream buffers must be written from offset 0; the data then lands at GetMappedOffset()
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+    // NOTE: Stream buffers only. Map returns GetSize() writable bytes that stay valid until Unmap. Vertices
+    // written there start at GetMappedOffset() in the buffer, so draws must add GetMappedOffset() / stride as
+    // the base vertex.
+    virtual void* Map() = 0;
+    virtual void Unmap(uint32_t size) = 0;
+    virtual uint32_t GetMappedOffset() const = 0;
+
+    virtual uint32_t GetSize() const = 0;
+    virtual BufferUsage GetUsage() const = 0;
+
     virtual const BufferLayout& GetLayout() const = 0;
     virtual void SetLayout(const BufferLayout& layout) = 0;
 
-    static VertexBuffer* Create(float* vertices, uint32_t size);
+    static Ref<VertexBuffer> Create(uint32_t size, BufferUsage usage = BufferUsage::Dynamic);
+    static Ref<VertexBuffer> Create(float* vertices, uint32_t size);
 };
 
 class IndexBuffer
@@ -171,8 +229,12 @@ public:
     virtual void Bind() const = 0;
     virtual void Unbind() const = 0;
 
+    // NOTE: Offset and count are in indices
+    virtual void SetData(const uint32_t* indices, uint32_t count, uint32_t offset = 0) = 0;
+
     virtual uint32_t GetCount() const = 0;
 
-    static IndexBuffer* Create(uint32_t* indices, uint32_t count);
+    static Ref<IndexBuffer> Create(uint32_t count, BufferUsage usage = BufferUsage::Dynamic);
+    static Ref<IndexBuffer> Create(uint32_t* indices, uint32_t count);
 };
 } // namespace Hazel
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "hzpch.h"
+#include "GPUProfiler.h"
+
+#include "GPUTimerQueries.h"
+#include "RenderThread.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace Hazel
+{
+
+struct GPUScopeRecord
+{
+    const char* Name;
+    uint32_t Index;
+    uint32_t Depth;
+    uint32_t BeginQuery;
+    uint32_t EndQuery;
+};
+
+struct GPUProfilerData
+{
+    Ref<GPUTimerQueries> Queries;
+
+    // NOTE: Main thread
+    uint32_t Frame = 0;
+    bool InFrame = false;
+    std::vector<GPUScopeRecord> Scopes;
+    std::vector<uint32_t> OpenScopes;
+    uint32_t QueryCount = 0;
+    bool DrawTiming = false;
+
+    // NOTE: Render thread; the scopes of each in-flight frame, waiting to be read back
+    std::vector<GPUScopeRecord> Pending[GPUProfiler::FrameLatency];
+    std::vector<uint64_t> Timestamps;
+
+    // NOTE: Published by the render thread, read by the main thread
+    std::mutex ResultsMutex;
+    std::vector<GPUProfileResult> Results;
+    float FrameTime = 0.0f;
+};
+
+static GPUProfilerData* s_Data = nullptr;
+
+static uint32_t WriteTimestamp()
+{
+    const uint32_t frame = s_Data->Frame;
+    const uint32_t query = s_Data->QueryCount++;
+    RenderThread::Submit([frame, query]() { s_Data->Queries->WriteTimestamp(frame, query); });
+    return query;
+}
+
+// NOTE: Runs on the render thread before a frame slot is reused
+static void Resolve(uint32_t frame)
+{
+    std::vector<GPUScopeRecord>& scopes = s_Data->Pending[frame];
+    if (scopes.empty())
+        return;
+
+    uint32_t queryCount = 0;
+    for (const GPUScopeRecord& scope : scopes)
+        queryCount = std::max(queryCount, scope.EndQuery + 1);
+
+    s_Data->Timestamps.resize(queryCount);
+    if (s_Data->Queries->ReadTimestamps(frame, queryCount, s_Data->Timestamps.data()))
+    {
+        std::vector<GPUProfileResult> results;
+        results.reserve(scopes.size());
+        for (const GPUScopeRecord& scope : scopes)
+        {
+            const uint64_t begin = s_Data->Timestamps[scope.BeginQuery];
+            const uint64_t end = s_Data->Timestamps[scope.EndQuery];
+            const float milliseconds = end > begin ? static_cast<float>(end - begin) * 1e-6f : 0.0f;
+            results.push_back({scope.Name, scope.Index, scope.Depth, milliseconds});
+        }
+
+        std::lock_guard<std::mutex> lock(s_Data->ResultsMutex);
+        s_Data->FrameTime = results.front().Milliseconds;
+        s_Data->Results = std::move(results);
+    }
+
+    scopes.clear();
+}
+
+void GPUProfiler::Init()
+{
+    s_Data = new GPUProfilerData();
+    s_Data->Queries = GPUTimerQueries::Create(FrameLatency);
+}
+
+void GPUProfiler::Shutdown()
+{
+    // NOTE: Queued commands still reference s_Data
+    RenderThread::WaitIdle();
+
+    delete s_Data;
+    s_Data = nullptr;
+}
+
+void GPUProfiler::BeginFrame()
+{
+    if (!s_Data)
+        return;
+
+    HZ_CORE_ASSERT(!s_Data->InFrame, "GPUProfiler::BeginFrame called twice!");
+    s_Data->InFrame = true;
+    s_Data->QueryCount = 0;
+
+    const uint32_t frame = s_Data->Frame;
+    RenderThread::Submit([frame]() { Resolve(frame); });
+
+    BeginScope("Frame");
+}
+
+void GPUProfiler::EndFrame()
+{
+    if (!s_Data)
+        return;
+
+    EndScope();
+    HZ_CORE_ASSERT(s_Data->OpenScopes.empty(), "GPU profile scope left open at end of frame!");
+    s_Data->InFrame = false;
+
+    const uint32_t frame = s_Data->Frame;
+    RenderThread::Submit([frame, scopes = std::move(s_Data->Scopes)]() mutable {
+        s_Data->Pending[frame] = std::move(scopes);
+    });
+    s_Data->Scopes = {};
+
+    s_Data->Frame = (frame + 1) % FrameLatency;
+}
+
+void GPUProfiler::BeginScope(const char* name, uint32_t index)
+{
+    // NOTE: Scopes outside BeginFrame/EndFrame (e.g. during startup) are ignored
+    if (!s_Data || !s_Data->InFrame)
+        return;
+
+    const uint32_t depth = static_cast<uint32_t>(s_Data->OpenScopes.size());
+    s_Data->OpenScopes.push_back(static_cast<uint32_t>(s_Data->Scopes.size()));
+    s_Data->Scopes.push_back({name, index, depth, WriteTimestamp(), 0});
+}
+
+void GPUProfiler::EndScope()
+{
+    if (!s_Data || !s_Data->InFrame)
+        return;
+
+    HZ_CORE_ASSERT(!s_Data->OpenScopes.empty(), "GPUProfiler::EndScope without a matching BeginScope!");
+    s_Data->Scopes[s_Data->OpenScopes.back()].EndQuery = WriteTimestamp();
+    s_Data->OpenScopes.pop_back();
+}
+
+void GPUProfiler::SetDrawTimingEnabled(bool enabled)
+{
+    if (s_Data)
+        s_Data->DrawTiming = enabled;
+}
+
+bool GPUProfiler::IsDrawTimingEnabled()
+{
+    return s_Data && s_Data->DrawTiming;
+}
+
+std::vector<GPUProfileResult> GPUProfiler::GetResults()
+{
+    if (!s_Data)
+        return {};
+
+    std::lock_guard<std::mutex> lock(s_Data->ResultsMutex);
+    return s_Data->Results;
+}
+
+float GPUProfiler::GetFrameTime()
+{
+    if (!s_Data)
+        return 0.0f;
+
+    std::lock_guard<std::mutex> lock(s_Data->ResultsMutex);
+    return s_Data->FrameTime;
+}
+
+} // namespace Hazel
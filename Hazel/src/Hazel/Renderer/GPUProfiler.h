@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Hazel
+{
+
+struct GPUProfileResult
+{
+    const char* Name = nullptr;
+    uint32_t Index = 0; // NOTE: Pass or draw number for scopes that repeat within a frame
+    uint32_t Depth = 0;
+    float Milliseconds = 0.0f;
+};
+
+// NOTE: Scoped GPU timing. Each scope writes a timestamp query at its start and end; a frame's queries are
+// read back FrameLatency frames later, once the GPU is done with them, so profiling never stalls the
+// pipeline. Results that still are not ready by then are dropped.
+//
+// Scope names must outlive the profiler (string literals). Call from the main thread; the query work is
+// routed through RenderThread.
+class GPUProfiler
+{
+public:
+    static constexpr uint32_t FrameLatency = 3;
+
+    static void Init();
+    static void Shutdown();
+
+    // NOTE: Application brackets every frame; the whole frame is the root scope
+    static void BeginFrame();
+    static void EndFrame();
+
+    static void BeginScope(const char* name, uint32_t index = 0);
+    static void EndScope();
+
+    // NOTE: Per-draw scopes cost two queries per draw, so they are off by default
+    static void SetDrawTimingEnabled(bool enabled);
+    static bool IsDrawTimingEnabled();
+
+    // NOTE: Scopes of the most recently resolved frame, in the order they began
+    static std::vector<GPUProfileResult> GetResults();
+    static float GetFrameTime();
+};
+
+class GPUProfileScope
+{
+public:
+    GPUProfileScope(const char* name, uint32_t index = 0)
+    {
+        GPUProfiler::BeginScope(name, index);
+    }
+    ~GPUProfileScope()
+    {
+        GPUProfiler::EndScope();
+    }
+
+    GPUProfileScope(const GPUProfileScope&) = delete;
+    GPUProfileScope& operator=(const GPUProfileScope&) = delete;
+};
+
+} // namespace Hazel
@@ -0,0 +1,26 @@
+#include "hzpch.h"
+#include "GPUTimerQueries.h"
+
+#include "RenderThread.h"
+#include "Renderer.h"
+#include "Platform/Null/NullGPUTimerQueries.h"
+#include "Platform/OpenGL/OpenGLGPUTimerQueries.h"
+
+namespace Hazel
+{
+
+Ref<GPUTimerQueries> GPUTimerQueries::Create(uint32_t frameCount)
+{
+    switch (Renderer::GetAPI())
+    {
+    case RendererAPI::API::None:
+        return RenderThread::CreateResource<NullGPUTimerQueries>(frameCount);
+    case RendererAPI::API::OpenGL:
+        return RenderThread::CreateResource<OpenGLGPUTimerQueries>(frameCount);
+    }
+
+    HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+    return nullptr;
+}
+
+} // namespace Hazel
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+#include <cstdint>
+
+namespace Hazel
+{
+
+// NOTE: Pool of GPU timestamp queries, one set per in-flight frame. Only the thread that owns the context
+// may call into it, i.e. from inside RenderThread::Submit.
+class GPUTimerQueries
+{
+public:
+    virtual ~GPUTimerQueries() = default;
+
+    // NOTE: Records the GPU time at which every command issued so far has completed
+    virtual void WriteTimestamp(uint32_t frame, uint32_t index) = 0;
+    // NOTE: Never blocks; returns false if the frame's timestamps have not all resolved yet
+    virtual bool ReadTimestamps(uint32_t frame, uint32_t count, uint64_t* nanoseconds) = 0;
+
+    static Ref<GPUTimerQueries> Create(uint32_t frameCount);
+};
+
+} // namespace Hazel
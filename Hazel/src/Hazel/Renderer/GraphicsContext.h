@@ -8,5 +8,9 @@ public:
     virtual ~GraphicsContext() = default;
     virtual void Init() = 0;
     virtual void SwapBuffers() = 0;
+
+    // NOTE: Moves the context between threads; it can be current on only one thread at a time
+    virtual void MakeCurrent() = 0;
+    virtual void ReleaseCurrent() = 0;
 };
 } // namespace Hazel
\ No newline at end of file
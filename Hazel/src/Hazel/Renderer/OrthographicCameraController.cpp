@@ -16,31 +16,35 @@ OrthographicCameraController::OrthographicCameraController(float aspectRatio, bo
 
 void OrthographicCameraController::OnUpdate(Timestep ts)
 {
-    if (Input::IsKeyPressed(HZ_KEY_A))
+    const InputSnapshot& input = Input::GetSnapshot();
+    const glm::vec3 position = m_CameraPosition;
+    const float rotation = m_CameraRotation;
+
+    if (input.IsKeyPressed(HZ_KEY_A))
     {
         m_CameraPosition.x -= m_CameraTranslationSpeed * ts;
     }
-    else if (Input::IsKeyPressed(HZ_KEY_D))
+    else if (input.IsKeyPressed(HZ_KEY_D))
     {
         m_CameraPosition.x += m_CameraTranslationSpeed * ts;
     }
 
-    if (Input::IsKeyPressed(HZ_KEY_W))
+    if (input.IsKeyPressed(HZ_KEY_W))
     {
         m_CameraPosition.y += m_CameraTranslationSpeed * ts;
     }
-    else if (Input::IsKeyPressed(HZ_KEY_S))
+    else if (input.IsKeyPressed(HZ_KEY_S))
     {
         m_CameraPosition.y -= m_CameraTranslationSpeed * ts;
     }
 
     if (m_Rotation)
     {
-        if (Input::IsKeyPressed(HZ_KEY_Q))
+        if (input.IsKeyPressed(HZ_KEY_Q))
         {
             m_CameraRotation += m_CameraRotationSpeed * ts;
         }
-        else if (Input::IsKeyPressed(HZ_KEY_E))
+        else if (input.IsKeyPressed(HZ_KEY_E))
         {
             m_CameraRotation -= m_CameraRotationSpeed * ts;
         }
@@ -49,6 +53,7 @@ void OrthographicCameraController::OnUpdate(Timestep ts)
     }
 
     m_Camera.SetPosition(m_CameraPosition);
+    m_Moving = m_CameraPosition != position || m_CameraRotation != rotation;
 
     m_CameraTranslationSpeed = m_ZoomLevel;
 }
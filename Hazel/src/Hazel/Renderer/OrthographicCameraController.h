@@ -34,6 +34,11 @@ public:
     {
         m_ZoomLevel = level;
     }
+    // NOTE: Whether the last OnUpdate moved or rotated the camera
+    bool IsMoving() const
+    {
+        return m_Moving;
+    }
 
 private:
     bool OnMouseScrolled(MouseScrolledEvent& e);
@@ -49,6 +54,7 @@ private:
     float m_CameraRotation = 0.0f;
     float m_CameraTranslationSpeed = 5.0f;
     float m_CameraRotationSpeed = 180.0f;
+    bool m_Moving = false;
 };
 
 } // namespace Hazel
\ No newline at end of file
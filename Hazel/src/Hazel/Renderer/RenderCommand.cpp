@@ -1,9 +1,8 @@
 #include "hzpch.h"
 #include "RenderCommand.h"
-#include "Platform/OpenGL/OpenGLRendererAPI.h"
 #include "RendererAPI.h"
 
 namespace Hazel
 {
-RendererAPI* RenderCommand::s_RendererAPI = new OpenGLRendererAPI;
+Scope<RendererAPI> RenderCommand::s_RendererAPI;
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "RenderStatistics.h"
 #include "RendererAPI.h"
 #include "VertexArray.h"
 
@@ -12,8 +13,10 @@ namespace Hazel
 class RenderCommand
 {
 public:
+    // NOTE: Creates the backend for RendererAPI::GetAPI()
     inline static void Init()
     {
+        s_RendererAPI = RendererAPI::Create();
         s_RendererAPI->Init();
     }
 
@@ -32,12 +35,47 @@ public:
         s_RendererAPI->Clear();
     }
 
-    inline static void DrawIndexed(const Ref<VertexArray>& vertexArray)
+    inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0)
     {
-        s_RendererAPI->DrawIndexed(vertexArray);
+        CountDraw(indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount(), 1);
+        s_RendererAPI->DrawIndexed(vertexArray, indexCount);
+    }
+
+    inline static void DrawIndexed(uint32_t indexCount)
+    {
+        CountDraw(indexCount, 1);
+        s_RendererAPI->DrawIndexed(indexCount);
+    }
+
+    inline static void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount,
+                                             uint32_t baseVertex)
+    {
+        CountDraw(indexCount, 1);
+        s_RendererAPI->DrawIndexedBaseVertex(vertexArray, indexCount, baseVertex);
+    }
+
+    inline static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount,
+                                            uint32_t indexCount = 0)
+    {
+        CountDraw(indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount(), instanceCount);
+        s_RendererAPI->DrawIndexedInstanced(vertexArray, instanceCount, indexCount);
+    }
+
+    inline static void DrawIndexedInstanced(uint32_t indexCount, uint32_t instanceCount)
+    {
+        CountDraw(indexCount, instanceCount);
+        s_RendererAPI->DrawIndexedInstanced(indexCount, instanceCount);
+    }
+
+private:
+    inline static void CountDraw(uint32_t indexCount, uint32_t instanceCount)
+    {
+        RenderCounters::Add(RenderCounters::Counter::DrawCalls);
+        RenderCounters::Add(RenderCounters::Counter::Indices, static_cast<uint64_t>(indexCount) * instanceCount);
+        RenderCounters::Add(RenderCounters::Counter::Instances, instanceCount);
     }
 
 private:
-    static RendererAPI* s_RendererAPI;
+    static Scope<RendererAPI> s_RendererAPI;
 };
 } // namespace Hazel
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include "hzpch.h"
+#include "RenderCommandBuffer.h"
+
+#include <algorithm>
+
+namespace Hazel
+{
+
+uint64_t RenderCommandBuffer::MakeSortKey(uint8_t pass, uint32_t shaderID, uint32_t textureID, uint32_t vertexArrayID)
+{
+    // NOTE: IDs are truncated to 16 bits. A collision only costs an extra state change, never a wrong draw,
+    // because execution compares the actual resources before binding.
+    return (static_cast<uint64_t>(pass) << 56) | (static_cast<uint64_t>(shaderID & 0xFFFF) << 40) |
+           (static_cast<uint64_t>(textureID & 0xFFFF) << 24) | (static_cast<uint64_t>(vertexArrayID & 0xFFFF) << 8);
+}
+
+void RenderCommandBuffer::Submit(uint64_t sortKey, const DrawCommand& command)
+{
+    m_Order.push_back({sortKey, static_cast<uint32_t>(m_Commands.size())});
+    m_Commands.push_back(command);
+}
+
+void RenderCommandBuffer::Sort()
+{
+    // NOTE: Only the 16-byte key/index pairs move; the index tiebreak keeps equal keys in submission order
+    std::sort(m_Order.begin(), m_Order.end(), [](const SortEntry& a, const SortEntry& b) {
+        return a.Key != b.Key ? a.Key < b.Key : a.Index < b.Index;
+    });
+}
+
+void RenderCommandBuffer::Clear()
+{
+    // NOTE: clear() keeps the capacity, so steady-state frames do not allocate
+    m_Commands.clear();
+    m_Order.clear();
+}
+
+} // namespace Hazel
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace Hazel
+{
+
+class Shader;
+class Texture;
+class VertexArray;
+
+// NOTE: Plain data only. Resources are referenced by raw pointer, so anything submitted must stay alive until
+// the buffer is executed (Renderer::EndScene).
+struct DrawCommand
+{
+    Shader* ShaderPtr = nullptr;
+    VertexArray* VertexArrayPtr = nullptr;
+    Texture* TexturePtr = nullptr;
+    glm::mat4 Transform;
+    uint32_t InstanceCount = 1;
+};
+
+// NOTE: Per-frame list of draw commands ordered by a 64-bit key. From most to least significant:
+//   [63..56] pass  [55..40] shader  [39..24] texture  [23..8] vertex array  [7..0] reserved
+// Sorting by key groups commands that share state so each bind happens once per group. Commands with
+// equal keys keep their submission order.
+class RenderCommandBuffer
+{
+public:
+    static uint64_t MakeSortKey(uint8_t pass, uint32_t shaderID, uint32_t textureID, uint32_t vertexArrayID);
+
+    void Submit(uint64_t sortKey, const DrawCommand& command);
+    void Sort();
+    void Clear();
+
+    uint32_t GetCount() const
+    {
+        return static_cast<uint32_t>(m_Commands.size());
+    }
+    bool IsEmpty() const
+    {
+        return m_Commands.empty();
+    }
+
+    // NOTE: Index is in sorted order once Sort() has been called, submission order otherwise
+    const DrawCommand& operator[](uint32_t index) const
+    {
+        return m_Commands[m_Order[index].Index];
+    }
+    uint64_t GetSortKey(uint32_t index) const
+    {
+        return m_Order[index].Key;
+    }
+
+private:
+    struct SortEntry
+    {
+        uint64_t Key;
+        uint32_t Index;
+    };
+
+    std::vector<DrawCommand> m_Commands;
+    std::vector<SortEntry> m_Order;
+};
+
+} // namespace Hazel
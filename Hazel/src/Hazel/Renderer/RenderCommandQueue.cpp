@@ -0,0 +1,91 @@
+#include "hzpch.h"
+#include "RenderCommandQueue.h"
+
+#include "Hazel/Core/Core.h"
+
+#include <new>
+
+namespace Hazel
+{
+
+namespace
+{
+struct alignas(RenderCommandQueue::Alignment) CommandHeader
+{
+    RenderCommandQueue::RenderCommandFn Fn;
+    uint32_t Size;
+};
+
+constexpr uint32_t AlignUp(uint32_t size)
+{
+    return (size + RenderCommandQueue::Alignment - 1) & ~(RenderCommandQueue::Alignment - 1);
+}
+} // namespace
+
+RenderCommandQueue::~RenderCommandQueue()
+{
+    HZ_CORE_ASSERT(m_CommandCount == 0, "Render command queue destroyed with pending commands!");
+
+    for (Chunk& chunk : m_Chunks)
+        ::operator delete[](chunk.Data, std::align_val_t(Alignment));
+}
+
+void* RenderCommandQueue::Allocate(RenderCommandFn fn, uint32_t size)
+{
+    m_CommandCount++;
+    return AllocateEntry(fn, size);
+}
+
+void* RenderCommandQueue::AllocateData(uint32_t size)
+{
+    return AllocateEntry(nullptr, size);
+}
+
+void* RenderCommandQueue::AllocateEntry(RenderCommandFn fn, uint32_t size)
+{
+    const uint32_t entrySize = static_cast<uint32_t>(sizeof(CommandHeader)) + AlignUp(size);
+
+    while (m_CurrentChunk < m_Chunks.size() &&
+           m_Chunks[m_CurrentChunk].Size + entrySize > m_Chunks[m_CurrentChunk].Capacity)
+        m_CurrentChunk++;
+
+    if (m_CurrentChunk == m_Chunks.size())
+    {
+        // NOTE: Oversized entries get a chunk of their own
+        Chunk chunk;
+        chunk.Capacity = std::max(ChunkSize, entrySize);
+        chunk.Data = static_cast<uint8_t*>(::operator new[](chunk.Capacity, std::align_val_t(Alignment)));
+        m_Chunks.push_back(chunk);
+    }
+
+    Chunk& chunk = m_Chunks[m_CurrentChunk];
+    CommandHeader* header = reinterpret_cast<CommandHeader*>(chunk.Data + chunk.Size);
+    header->Fn = fn;
+    header->Size = AlignUp(size);
+    chunk.Size += entrySize;
+
+    return header + 1;
+}
+
+void RenderCommandQueue::Execute()
+{
+    for (Chunk& chunk : m_Chunks)
+    {
+        uint32_t offset = 0;
+        while (offset < chunk.Size)
+        {
+            CommandHeader* header = reinterpret_cast<CommandHeader*>(chunk.Data + offset);
+            if (header->Fn)
+                header->Fn(header + 1);
+
+            offset += static_cast<uint32_t>(sizeof(CommandHeader)) + header->Size;
+        }
+
+        chunk.Size = 0;
+    }
+
+    m_CurrentChunk = 0;
+    m_CommandCount = 0;
+}
+
+} // namespace Hazel
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Hazel
+{
+
+// NOTE: Append-only stream of type-erased commands stored inline in fixed-size chunks. Chunks never move, so
+// pointers handed out by Allocate stay valid until Execute, and are reused by the next frame without freeing.
+class RenderCommandQueue
+{
+public:
+    using RenderCommandFn = void (*)(void*);
+
+    static constexpr uint32_t Alignment = 16;
+    static constexpr uint32_t ChunkSize = 1024 * 1024;
+
+    RenderCommandQueue() = default;
+    ~RenderCommandQueue();
+
+    RenderCommandQueue(const RenderCommandQueue&) = delete;
+    RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+    // NOTE: Returns storage for the command payload; fn receives that storage when the command executes
+    void* Allocate(RenderCommandFn fn, uint32_t size);
+    // NOTE: Raw bytes that live as long as the commands recorded alongside them
+    void* AllocateData(uint32_t size);
+
+    // NOTE: Runs every command in submission order and leaves the queue empty
+    void Execute();
+
+    uint32_t GetCommandCount() const
+    {
+        return m_CommandCount;
+    }
+
+private:
+    struct Chunk
+    {
+        uint8_t* Data = nullptr;
+        uint32_t Capacity = 0;
+        uint32_t Size = 0;
+    };
+
+    void* AllocateEntry(RenderCommandFn fn, uint32_t size);
+
+private:
+    std::vector<Chunk> m_Chunks;
+    uint32_t m_CurrentChunk = 0;
+    uint32_t m_CommandCount = 0;
+};
+
+} // namespace Hazel
@@ -0,0 +1,33 @@
+#include "hzpch.h"
+#include "RenderStatistics.h"
+
+namespace Hazel
+{
+
+RenderCounters::Slot RenderCounters::s_Counters[static_cast<size_t>(RenderCounters::Counter::Count)];
+
+RenderStatistics RenderCounters::Snapshot()
+{
+    auto load = [](Counter counter) {
+        return s_Counters[static_cast<size_t>(counter)].Value.load(std::memory_order_relaxed);
+    };
+
+    RenderStatistics stats;
+    stats.DrawCalls = load(Counter::DrawCalls);
+    stats.Indices = load(Counter::Indices);
+    stats.Instances = load(Counter::Instances);
+    stats.ShaderBinds = load(Counter::ShaderBinds);
+    stats.TextureBinds = load(Counter::TextureBinds);
+    stats.VertexArrayBinds = load(Counter::VertexArrayBinds);
+    stats.BufferBytesUploaded = load(Counter::BufferBytesUploaded);
+    stats.TextureBytesUploaded = load(Counter::TextureBytesUploaded);
+    return stats;
+}
+
+void RenderCounters::Reset()
+{
+    for (Slot& slot : s_Counters)
+        slot.Value.store(0, std::memory_order_relaxed);
+}
+
+} // namespace Hazel
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace Hazel
+{
+
+// NOTE: Snapshot returned by Renderer::GetStats
+struct RenderStatistics
+{
+    uint64_t DrawCalls = 0;
+    uint64_t Indices = 0; // NOTE: Summed over instances
+    uint64_t Instances = 0;
+    uint64_t ShaderBinds = 0;
+    uint64_t TextureBinds = 0;
+    uint64_t VertexArrayBinds = 0;
+    uint64_t BufferBytesUploaded = 0;
+    uint64_t TextureBytesUploaded = 0;
+};
+
+// NOTE: Counters bumped by RenderCommand and the backends on the submitting thread. Binds are counted as
+// requested; OpenGLStateCache::GetStatistics reports how many of them actually reached the driver.
+//
+// Each counter sits on its own cache line, so threads that submit (or read a snapshot) concurrently never
+// contend on a line another counter lives on.
+class RenderCounters
+{
+public:
+    enum class Counter : uint8_t
+    {
+        DrawCalls = 0,
+        Indices,
+        Instances,
+        ShaderBinds,
+        TextureBinds,
+        VertexArrayBinds,
+        BufferBytesUploaded,
+        TextureBytesUploaded,
+
+        Count
+    };
+
+    inline static void Add(Counter counter, uint64_t value = 1)
+    {
+        s_Counters[static_cast<size_t>(counter)].Value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    static RenderStatistics Snapshot();
+    static void Reset();
+
+private:
+    static constexpr size_t CacheLineSize = 64;
+
+    struct alignas(CacheLineSize) Slot
+    {
+        std::atomic<uint64_t> Value{0};
+    };
+    static_assert(sizeof(Slot) == CacheLineSize, "Counters must not share a cache line");
+
+    static Slot s_Counters[static_cast<size_t>(Counter::Count)];
+};
+
+} // namespace Hazel
@@ -0,0 +1,150 @@
+#include "hzpch.h"
+#include "RenderThread.h"
+
+#include "GraphicsContext.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace Hazel
+{
+
+struct RenderThreadData
+{
+    std::thread Thread;
+    std::thread::id ThreadID;
+    std::atomic<bool> Running{false};
+
+    std::mutex Mutex;
+    std::condition_variable Condition;
+    bool ExecutePending = false;
+    bool StopRequested = false;
+
+    // NOTE: Double buffered; the main thread records into SubmitIndex while the other queue executes
+    RenderCommandQueue Queues[2];
+    uint32_t SubmitIndex = 0;
+    uint32_t ExecuteIndex = 1;
+
+    GraphicsContext* Context = nullptr;
+};
+
+static RenderThreadData s_Data;
+
+static void RenderThreadLoop()
+{
+    s_Data.Context->MakeCurrent();
+
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(s_Data.Mutex);
+        s_Data.Condition.wait(lock, [] { return s_Data.ExecutePending || s_Data.StopRequested; });
+        if (!s_Data.ExecutePending)
+            break;
+
+        RenderCommandQueue& queue = s_Data.Queues[s_Data.ExecuteIndex];
+        lock.unlock();
+
+        {
+            HZ_PROFILE_SCOPE("RenderThread Execute");
+            queue.Execute();
+        }
+
+        lock.lock();
+        s_Data.ExecutePending = false;
+        s_Data.Condition.notify_all();
+    }
+
+    s_Data.Context->ReleaseCurrent();
+}
+
+// NOTE: Swaps the queues once the render thread has finished the previous one. This wait is the bounded
+// hand-off: the main thread can run at most one frame ahead.
+static void Kick()
+{
+    std::unique_lock<std::mutex> lock(s_Data.Mutex);
+    s_Data.Condition.wait(lock, [] { return !s_Data.ExecutePending; });
+
+    s_Data.ExecuteIndex = s_Data.SubmitIndex;
+    s_Data.SubmitIndex ^= 1;
+    s_Data.ExecutePending = true;
+    s_Data.Condition.notify_all();
+}
+
+void RenderThread::Start(GraphicsContext* context)
+{
+    HZ_CORE_ASSERT(!IsRunning(), "Render thread is already running!");
+    HZ_CORE_ASSERT(context, "Render thread needs a graphics context!");
+
+    s_Data.Context = context;
+    s_Data.StopRequested = false;
+    s_Data.ExecutePending = false;
+    s_Data.Thread = std::thread(RenderThreadLoop);
+    s_Data.ThreadID = s_Data.Thread.get_id();
+    s_Data.Running = true;
+}
+
+void RenderThread::Stop()
+{
+    if (!IsRunning())
+        return;
+
+    WaitIdle();
+
+    {
+        std::lock_guard<std::mutex> lock(s_Data.Mutex);
+        s_Data.StopRequested = true;
+    }
+    s_Data.Condition.notify_all();
+    s_Data.Thread.join();
+
+    s_Data.Running = false;
+    s_Data.ThreadID = std::thread::id();
+    s_Data.Context = nullptr;
+}
+
+bool RenderThread::IsRunning()
+{
+    return s_Data.Running.load(std::memory_order_acquire);
+}
+
+bool RenderThread::IsRecording()
+{
+    return IsRunning() && std::this_thread::get_id() != s_Data.ThreadID;
+}
+
+const void* RenderThread::CopyFrameData(const void* data, uint32_t size)
+{
+    if (!IsRecording())
+        return data;
+
+    void* copy = GetSubmitQueue().AllocateData(size);
+    std::memcpy(copy, data, size);
+    return copy;
+}
+
+void RenderThread::NextFrame()
+{
+    if (IsRecording())
+        Kick();
+}
+
+void RenderThread::WaitIdle()
+{
+    if (!IsRecording())
+        return;
+
+    Kick();
+
+    std::unique_lock<std::mutex> lock(s_Data.Mutex);
+    s_Data.Condition.wait(lock, [] { return !s_Data.ExecutePending; });
+}
+
+RenderCommandQueue& RenderThread::GetSubmitQueue()
+{
+    return s_Data.Queues[s_Data.SubmitIndex];
+}
+
+} // namespace Hazel
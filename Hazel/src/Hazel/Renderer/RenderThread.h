@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+#include "RenderCommandQueue.h"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Hazel
+{
+
+class GraphicsContext;
+
+// NOTE: Opt-in thread that owns the graphics context and executes every GPU call. The main thread records a
+// frame into one command queue while the render thread executes the previous one; NextFrame hands the
+// recorded queue over and blocks only if the render thread is still a full frame behind.
+//
+// When the thread is not running, or when called from the render thread itself, Submit executes inline, so
+// code written against it behaves exactly like direct GL calls in single-threaded mode.
+class RenderThread
+{
+public:
+    // NOTE: The context must not be current on the calling thread; it is made current on the render thread
+    static void Start(GraphicsContext* context);
+    // NOTE: Drains every recorded command and releases the context before joining
+    static void Stop();
+
+    static bool IsRunning();
+    // NOTE: True when Submit records instead of executing, i.e. the thread is running and this is not it
+    static bool IsRecording();
+
+    template <typename FuncT> static void Submit(FuncT&& func)
+    {
+        using Command = std::decay_t<FuncT>;
+        static_assert(alignof(Command) <= RenderCommandQueue::Alignment, "Render command is over-aligned!");
+
+        if (!IsRecording())
+        {
+            func();
+            return;
+        }
+
+        auto execute = [](void* storage) {
+            Command* command = static_cast<Command*>(storage);
+            (*command)();
+            command->~Command();
+        };
+        void* storage = GetSubmitQueue().Allocate(execute, static_cast<uint32_t>(sizeof(Command)));
+        new (storage) Command(std::forward<FuncT>(func));
+    }
+
+    // NOTE: For work whose results the caller needs right away, e.g. creating a GPU object and reading its ID
+    template <typename FuncT> static void SubmitAndWait(FuncT&& func)
+    {
+        Submit(std::forward<FuncT>(func));
+        if (IsRecording())
+            WaitIdle();
+    }
+
+    // NOTE: Copies data into the recording frame so a queued command can read it after the caller's buffer is
+    // reused. Returns data unchanged when commands execute inline.
+    static const void* CopyFrameData(const void* data, uint32_t size);
+
+    // NOTE: Resources referenced by queued commands must outlive them, so the final delete is queued as well
+    template <typename T, typename... Args> static Ref<T> CreateResource(Args&&... args)
+    {
+        return Ref<T>(new T(std::forward<Args>(args)...),
+                      [](T* resource) { Submit([resource]() { delete resource; }); });
+    }
+
+    // NOTE: Hands the recorded frame to the render thread
+    static void NextFrame();
+    // NOTE: Hands over whatever has been recorded and waits until the render thread has executed it
+    static void WaitIdle();
+
+private:
+    static RenderCommandQueue& GetSubmitQueue();
+};
+
+} // namespace Hazel
@@ -1,43 +1,186 @@
 #include "hzpch.h"
 
+#include "GPUProfiler.h"
 #include "RenderCommand.h"
+#include "RenderCommandBuffer.h"
 #include "Renderer.h"
+#include "Renderer2D.h"
+#include "UniformBuffer.h"
 #include "VertexArray.h"
 
-#include "Platform/OpenGL/OpenGLShader.h"
-
 namespace Hazel
 {
 
-Renderer::SceneData* Renderer::s_SceneData = new Renderer::SceneData;
+static constexpr ShaderUniform s_TransformUniform("u_Transform");
+
+Renderer::SceneData Renderer::s_SceneData;
+
+static Ref<UniformBuffer> s_SceneUniformBuffer;
+
+static RenderCommandBuffer s_CommandBuffer;
+static uint8_t s_RenderPass = 0;
 
 void Renderer::Init()
 {
+    HZ_PROFILE_FUNCTION();
+
     RenderCommand::Init();
+    GPUProfiler::Init();
+    s_SceneUniformBuffer = UniformBuffer::Create(sizeof(SceneData), UniformBufferBinding::SceneData);
+    Renderer2D::Init();
+}
+
+void Renderer::Shutdown()
+{
+    HZ_PROFILE_FUNCTION();
+
+    Renderer2D::Shutdown();
+    s_SceneUniformBuffer.reset();
+    GPUProfiler::Shutdown();
 }
 
 void Renderer::OnWindowResize(uint32_t width, uint32_t height)
 {
     RenderCommand::SetViewport(0, 0, width, height);
+    s_SceneData.ViewportSize = {static_cast<float>(width), static_cast<float>(height)};
+}
+
+void Renderer::SetTime(float time)
+{
+    s_SceneData.Time = time;
 }
 
 void Renderer::BeginScene(const OrthographicCamera& camera)
 {
-    s_SceneData->ViewProjectionMatrix = camera.GetViewProjectionMatrix();
+    HZ_PROFILE_FUNCTION();
+    HZ_MEMORY_SCOPE("Renderer");
+
+    RenderCounters::Reset();
+    GPUProfiler::BeginScope("Scene");
+    UploadSceneData(camera);
+    s_CommandBuffer.Clear();
+    s_RenderPass = 0;
 }
 
 void Renderer::EndScene()
 {
+    HZ_PROFILE_FUNCTION();
+    HZ_MEMORY_SCOPE("Renderer");
+
+    s_CommandBuffer.Sort();
+
+    Shader* boundShader = nullptr;
+    Texture* boundTexture = nullptr;
+    VertexArray* boundVertexArray = nullptr;
+
+    const bool drawTiming = GPUProfiler::IsDrawTimingEnabled();
+    bool passScopeOpen = false;
+    uint32_t currentPass = 0;
+
+    for (uint32_t i = 0; i < s_CommandBuffer.GetCount(); i++)
+    {
+        const DrawCommand& command = s_CommandBuffer[i];
+
+        const uint32_t pass = static_cast<uint32_t>(s_CommandBuffer.GetSortKey(i) >> 56);
+        if (!passScopeOpen || pass != currentPass)
+        {
+            if (passScopeOpen)
+                GPUProfiler::EndScope();
+
+            GPUProfiler::BeginScope("Pass", pass);
+            passScopeOpen = true;
+            currentPass = pass;
+        }
+
+        if (command.ShaderPtr != boundShader)
+        {
+            boundShader = command.ShaderPtr;
+            boundShader->Bind();
+        }
+
+        if (command.TexturePtr && command.TexturePtr != boundTexture)
+        {
+            boundTexture = command.TexturePtr;
+            boundTexture->Bind();
+        }
+
+        if (command.VertexArrayPtr != boundVertexArray)
+        {
+            boundVertexArray = command.VertexArrayPtr;
+            boundVertexArray->Bind();
+        }
+
+        boundShader->SetMat4(s_TransformUniform, command.Transform);
+
+        if (drawTiming)
+            GPUProfiler::BeginScope("Draw", i);
+
+        const uint32_t indexCount = boundVertexArray->GetIndexBuffer()->GetCount();
+        if (command.InstanceCount > 1)
+            RenderCommand::DrawIndexedInstanced(indexCount, command.InstanceCount);
+        else
+            RenderCommand::DrawIndexed(indexCount);
+
+        if (drawTiming)
+            GPUProfiler::EndScope();
+    }
+
+    if (passScopeOpen)
+        GPUProfiler::EndScope();
+
+    s_CommandBuffer.Clear();
+    GPUProfiler::EndScope();
+}
+
+void Renderer::UploadSceneData(const OrthographicCamera& camera)
+{
+    HZ_PROFILE_FUNCTION();
+
+    static_assert(sizeof(SceneData) == 208, "SceneData must match the std140 uniform block layout");
+
+    s_SceneData.View = camera.GetViewMatrix();
+    s_SceneData.Projection = camera.GetProjectionMatrix();
+    s_SceneData.ViewProjection = camera.GetViewProjectionMatrix();
+    s_SceneUniformBuffer->SetData(&s_SceneData, sizeof(SceneData));
+}
+
+RenderStatistics Renderer::GetStats()
+{
+    return RenderCounters::Snapshot();
+}
+
+void Renderer::SetRenderPass(uint8_t pass)
+{
+    s_RenderPass = pass;
 }
 
 void Renderer::Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform)
 {
-    shader->Bind();
-    std::dynamic_pointer_cast<OpenGLShader>(shader)->UploadUniformMat4("u_ViewProjection",
-                                                                       s_SceneData->ViewProjectionMatrix);
-    std::dynamic_pointer_cast<OpenGLShader>(shader)->UploadUniformMat4("u_Transform", transform);
+    Submit(shader, vertexArray, nullptr, transform);
+}
+
+void Renderer::Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const Ref<Texture>& texture,
+                      const glm::mat4& transform)
+{
+    HZ_PROFILE_FUNCTION();
+    HZ_MEMORY_SCOPE("Renderer");
+
+    uint32_t textureID = texture ? texture->GetRendererID() : 0;
+    uint64_t sortKey = RenderCommandBuffer::MakeSortKey(s_RenderPass, shader->GetRendererID(), textureID,
+                                                        vertexArray->GetRendererID());
+    s_CommandBuffer.Submit(sortKey, {shader.get(), vertexArray.get(), texture.get(), transform});
+}
+
+void Renderer::SubmitInstanced(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray,
+                               uint32_t instanceCount, const glm::mat4& transform)
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (instanceCount == 0)
+        return;
 
-    vertexArray->Bind();
-    RenderCommand::DrawIndexed(vertexArray);
+    uint64_t sortKey =
+        RenderCommandBuffer::MakeSortKey(s_RenderPass, shader->GetRendererID(), 0, vertexArray->GetRendererID());
+    s_CommandBuffer.Submit(sortKey, {shader.get(), vertexArray.get(), nullptr, transform, instanceCount});
 }
 } // namespace Hazel
\ No newline at end of file
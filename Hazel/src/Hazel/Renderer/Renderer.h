@@ -1,8 +1,10 @@
 #pragma once
 
 #include "OrthographicCamera.h"
+#include "RenderStatistics.h"
 #include "RendererAPI.h"
 #include "Shader.h"
+#include "Texture.h"
 #include "VertexArray.h"
 
 #include <glm/fwd.hpp>
@@ -14,13 +16,34 @@ class Renderer
 {
 public:
     static void Init();
+    static void Shutdown();
     static void OnWindowResize(uint32_t width, uint32_t height);
+    // NOTE: Seconds since startup, exposed to shaders as u_Time
+    static void SetTime(float time);
 
+    // NOTE: Submit only records a draw. EndScene sorts everything recorded since BeginScene by
+    // pass, shader, texture and vertex array, then executes it with redundant binds skipped.
     static void BeginScene(const OrthographicCamera& camera);
     static void EndScene();
 
+    // NOTE: Writes the SceneData uniform block shared by every shader. BeginScene calls this; other
+    // renderers (Renderer2D) call it directly so they see the same camera without a per-shader upload.
+    static void UploadSceneData(const OrthographicCamera& camera);
+
+    // NOTE: Passes execute in ascending order; the pass is reset to 0 at BeginScene
+    static void SetRenderPass(uint8_t pass);
+
     static void Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray,
                        const glm::mat4& transform = glm::mat4(1.0f));
+    static void Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const Ref<Texture>& texture,
+                       const glm::mat4& transform = glm::mat4(1.0f));
+    // NOTE: Draws instanceCount copies in one call; per-instance data comes from vertex buffers whose
+    // elements have a non-zero divisor
+    static void SubmitInstanced(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray,
+                                uint32_t instanceCount, const glm::mat4& transform = glm::mat4(1.0f));
+
+    // NOTE: Counters since the last BeginScene; Renderer2D draws issued after it are included
+    static RenderStatistics GetStats();
 
     inline static RendererAPI::API GetAPI()
     {
@@ -28,11 +51,17 @@ public:
     }
 
 private:
+    // NOTE: Mirrors the std140 layout of the SceneData uniform block
     struct SceneData
     {
-        glm::mat4 ViewProjectionMatrix;
+        glm::mat4 View;
+        glm::mat4 Projection;
+        glm::mat4 ViewProjection;
+        glm::vec2 ViewportSize;
+        float Time;
+        float Padding;
     };
 
-    static SceneData* s_SceneData;
+    static SceneData s_SceneData;
 };
 } // namespace Hazel
\ No newline at end of file
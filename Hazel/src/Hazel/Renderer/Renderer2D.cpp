@@ -0,0 +1,346 @@
+#include "hzpch.h"
+#include "Renderer2D.h"
+
+#include "GPUProfiler.h"
+#include "RenderCommand.h"
+#include "Renderer.h"
+#include "Shader.h"
+#include "VertexArray.h"
+
+#include <cmath>
+
+namespace Hazel
+{
+
+struct QuadVertex
+{
+    glm::vec3 Position;
+    glm::vec4 Color;
+    glm::vec2 TexCoord;
+    float TexIndex;
+    float TilingFactor;
+};
+
+struct Renderer2DData
+{
+    static const uint32_t MaxQuads = 20000;
+    static const uint32_t MaxVertices = MaxQuads * 4;
+    static const uint32_t MaxIndices = MaxQuads * 6;
+    static const uint32_t MaxTextureSlots = 16; // NOTE: Guaranteed minimum of fragment texture units
+
+    Ref<VertexArray> QuadVertexArray;
+    Ref<VertexBuffer> QuadVertexBuffer;
+    Ref<Shader> QuadShader;
+    Ref<Texture2D> WhiteTexture;
+
+    uint32_t QuadIndexCount = 0;
+    QuadVertex* QuadVertexBufferBase = nullptr;
+    QuadVertex* QuadVertexBufferPtr = nullptr;
+
+    std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;
+    uint32_t TextureSlotIndex = 1; // NOTE: 0 = white texture
+    uint32_t BatchIndex = 0;
+
+    glm::vec4 QuadVertexPositions[4];
+};
+
+static Renderer2DData s_Data;
+
+static constexpr ShaderUniform s_TexturesUniform("u_Textures");
+
+static const glm::vec2 s_QuadTexCoords[4] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+
+static void StartBatch()
+{
+    s_Data.QuadIndexCount = 0;
+    s_Data.QuadVertexBufferBase = static_cast<QuadVertex*>(s_Data.QuadVertexBuffer->Map());
+    s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
+
+    s_Data.TextureSlotIndex = 1;
+}
+
+static void FlushBatch()
+{
+    HZ_PROFILE_FUNCTION();
+    HZ_MEMORY_SCOPE("Renderer2D");
+
+    uint32_t dataSize = static_cast<uint32_t>(reinterpret_cast<uint8_t*>(s_Data.QuadVertexBufferPtr) -
+                                              reinterpret_cast<uint8_t*>(s_Data.QuadVertexBufferBase));
+    s_Data.QuadVertexBuffer->Unmap(dataSize);
+
+    if (s_Data.QuadIndexCount == 0)
+        return;
+
+    for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++)
+        s_Data.TextureSlots[i]->Bind(i);
+
+    const bool drawTiming = GPUProfiler::IsDrawTimingEnabled();
+    if (drawTiming)
+        GPUProfiler::BeginScope("Batch", s_Data.BatchIndex);
+
+    s_Data.QuadShader->Bind();
+    const uint32_t baseVertex = s_Data.QuadVertexBuffer->GetMappedOffset() / sizeof(QuadVertex);
+    RenderCommand::DrawIndexedBaseVertex(s_Data.QuadVertexArray, s_Data.QuadIndexCount, baseVertex);
+
+    if (drawTiming)
+        GPUProfiler::EndScope();
+    s_Data.BatchIndex++;
+}
+
+static void NextBatch()
+{
+    FlushBatch();
+    StartBatch();
+}
+
+void Renderer2D::Init()
+{
+    HZ_PROFILE_FUNCTION();
+
+    s_Data.QuadVertexArray = VertexArray::Create();
+
+    // NOTE: Quads are written straight into the stream buffer's mapping; no CPU-side staging copy
+    s_Data.QuadVertexBuffer =
+        VertexBuffer::Create(Renderer2DData::MaxVertices * sizeof(QuadVertex), BufferUsage::Stream);
+    s_Data.QuadVertexBuffer->SetLayout({{ShaderDataType::Float3, "a_Position"},
+                                        {ShaderDataType::Float4, "a_Color"},
+                                        {ShaderDataType::Float2, "a_TexCoord"},
+                                        {ShaderDataType::Float, "a_TexIndex"},
+                                        {ShaderDataType::Float, "a_TilingFactor"}});
+    s_Data.QuadVertexArray->AddVertexBuffer(s_Data.QuadVertexBuffer);
+
+    // NOTE: Every quad shares the same index pattern, so one static index buffer serves all batches
+    uint32_t* quadIndices = new uint32_t[Renderer2DData::MaxIndices];
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < Renderer2DData::MaxIndices; i += 6)
+    {
+        quadIndices[i + 0] = offset + 0;
+        quadIndices[i + 1] = offset + 1;
+        quadIndices[i + 2] = offset + 2;
+
+        quadIndices[i + 3] = offset + 2;
+        quadIndices[i + 4] = offset + 3;
+        quadIndices[i + 5] = offset + 0;
+
+        offset += 4;
+    }
+
+    Ref<IndexBuffer> quadIB = IndexBuffer::Create(quadIndices, Renderer2DData::MaxIndices);
+    s_Data.QuadVertexArray->SetIndexBuffer(quadIB);
+    delete[] quadIndices;
+
+    s_Data.WhiteTexture = Texture2D::Create(1, 1);
+    uint32_t whiteTextureData = 0xffffffff;
+    s_Data.WhiteTexture->SetData(&whiteTextureData, sizeof(uint32_t));
+
+    int samplers[Renderer2DData::MaxTextureSlots];
+    for (uint32_t i = 0; i < Renderer2DData::MaxTextureSlots; i++)
+        samplers[i] = static_cast<int>(i);
+
+    s_Data.QuadShader = Shader::Create("assets/shaders/Renderer2D.glsl");
+    s_Data.QuadShader->Bind();
+    s_Data.QuadShader->SetIntArray(s_TexturesUniform, samplers, Renderer2DData::MaxTextureSlots);
+
+    s_Data.TextureSlots[0] = s_Data.WhiteTexture;
+
+    s_Data.QuadVertexPositions[0] = {-0.5f, -0.5f, 0.0f, 1.0f};
+    s_Data.QuadVertexPositions[1] = {0.5f, -0.5f, 0.0f, 1.0f};
+    s_Data.QuadVertexPositions[2] = {0.5f, 0.5f, 0.0f, 1.0f};
+    s_Data.QuadVertexPositions[3] = {-0.5f, 0.5f, 0.0f, 1.0f};
+}
+
+void Renderer2D::Shutdown()
+{
+    HZ_PROFILE_FUNCTION();
+
+    s_Data.QuadVertexBufferBase = nullptr;
+    s_Data.QuadVertexBufferPtr = nullptr;
+
+    s_Data.TextureSlots = {};
+    s_Data.WhiteTexture.reset();
+    s_Data.QuadShader.reset();
+    s_Data.QuadVertexBuffer.reset();
+    s_Data.QuadVertexArray.reset();
+}
+
+void Renderer2D::BeginScene(const OrthographicCamera& camera)
+{
+    HZ_PROFILE_FUNCTION();
+
+    GPUProfiler::BeginScope("Renderer2D");
+    Renderer::UploadSceneData(camera);
+    s_Data.BatchIndex = 0;
+
+    StartBatch();
+}
+
+void Renderer2D::EndScene()
+{
+    HZ_PROFILE_FUNCTION();
+
+    FlushBatch();
+    GPUProfiler::EndScope();
+}
+
+void Renderer2D::Flush()
+{
+    NextBatch();
+}
+
+static float GetTextureIndex(const Ref<Texture2D>& texture)
+{
+    for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
+    {
+        if (s_Data.TextureSlots[i].get() == texture.get())
+            return static_cast<float>(i);
+    }
+
+    return -1.0f;
+}
+
+static void WriteQuad(const glm::vec3 (&positions)[4], const glm::vec4& color, float textureIndex, float tilingFactor)
+{
+    QuadVertex* vertex = s_Data.QuadVertexBufferPtr;
+    for (int i = 0; i < 4; i++)
+    {
+        vertex[i].Position = positions[i];
+        vertex[i].Color = color;
+        vertex[i].TexCoord = s_QuadTexCoords[i];
+        vertex[i].TexIndex = textureIndex;
+        vertex[i].TilingFactor = tilingFactor;
+    }
+
+    s_Data.QuadVertexBufferPtr += 4;
+    s_Data.QuadIndexCount += 6;
+}
+
+static void GetAxisAlignedCorners(const glm::vec3& position, const glm::vec2& size, glm::vec3 (&corners)[4])
+{
+    const float halfWidth = size.x * 0.5f;
+    const float halfHeight = size.y * 0.5f;
+
+    corners[0] = {position.x - halfWidth, position.y - halfHeight, position.z};
+    corners[1] = {position.x + halfWidth, position.y - halfHeight, position.z};
+    corners[2] = {position.x + halfWidth, position.y + halfHeight, position.z};
+    corners[3] = {position.x - halfWidth, position.y + halfHeight, position.z};
+}
+
+static void GetRotatedCorners(const glm::vec3& position, const glm::vec2& size, float rotation,
+                              glm::vec3 (&corners)[4])
+{
+    const float radians = glm::radians(rotation);
+    const float c = std::cos(radians);
+    const float s = std::sin(radians);
+
+    for (int i = 0; i < 4; i++)
+    {
+        const float x = s_Data.QuadVertexPositions[i].x * size.x;
+        const float y = s_Data.QuadVertexPositions[i].y * size.y;
+        corners[i] = {position.x + x * c - y * s, position.y + x * s + y * c, position.z};
+    }
+}
+
+static void GetTransformedCorners(const glm::mat4& transform, glm::vec3 (&corners)[4])
+{
+    for (int i = 0; i < 4; i++)
+        corners[i] = glm::vec3(transform * s_Data.QuadVertexPositions[i]);
+}
+
+static void SubmitColoredQuad(const glm::vec3 (&corners)[4], const glm::vec4& color)
+{
+    if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+        NextBatch();
+
+    WriteQuad(corners, color, 0.0f, 1.0f);
+}
+
+static void SubmitTexturedQuad(const glm::vec3 (&corners)[4], const Ref<Texture2D>& texture, float tilingFactor,
+                               const glm::vec4& tintColor)
+{
+    if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+        NextBatch();
+
+    float textureIndex = GetTextureIndex(texture);
+    if (textureIndex < 0.0f)
+    {
+        if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
+            NextBatch();
+
+        textureIndex = static_cast<float>(s_Data.TextureSlotIndex);
+        s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
+        s_Data.TextureSlotIndex++;
+    }
+
+    WriteQuad(corners, tintColor, textureIndex, tilingFactor);
+}
+
+void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
+{
+    DrawQuad({position.x, position.y, 0.0f}, size, color);
+}
+
+void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+{
+    glm::vec3 corners[4];
+    GetAxisAlignedCorners(position, size, corners);
+    SubmitColoredQuad(corners, color);
+}
+
+void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<Texture2D>& texture,
+                          float tilingFactor, const glm::vec4& tintColor)
+{
+    DrawQuad({position.x, position.y, 0.0f}, size, texture, tilingFactor, tintColor);
+}
+
+void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture,
+                          float tilingFactor, const glm::vec4& tintColor)
+{
+    glm::vec3 corners[4];
+    GetAxisAlignedCorners(position, size, corners);
+    SubmitTexturedQuad(corners, texture, tilingFactor, tintColor);
+}
+
+void Renderer2D::DrawQuad(const glm::mat4& transform, const glm::vec4& color)
+{
+    glm::vec3 corners[4];
+    GetTransformedCorners(transform, corners);
+    SubmitColoredQuad(corners, color);
+}
+
+void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor,
+                          const glm::vec4& tintColor)
+{
+    glm::vec3 corners[4];
+    GetTransformedCorners(transform, corners);
+    SubmitTexturedQuad(corners, texture, tilingFactor, tintColor);
+}
+
+void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation,
+                                 const glm::vec4& color)
+{
+    DrawRotatedQuad({position.x, position.y, 0.0f}, size, rotation, color);
+}
+
+void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
+                                 const glm::vec4& color)
+{
+    glm::vec3 corners[4];
+    GetRotatedCorners(position, size, rotation, corners);
+    SubmitColoredQuad(corners, color);
+}
+
+void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation,
+                                 const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
+{
+    DrawRotatedQuad({position.x, position.y, 0.0f}, size, rotation, texture, tilingFactor, tintColor);
+}
+
+void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
+                                 const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
+{
+    glm::vec3 corners[4];
+    GetRotatedCorners(position, size, rotation, corners);
+    SubmitTexturedQuad(corners, texture, tilingFactor, tintColor);
+}
+
+} // namespace Hazel
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+#include "OrthographicCamera.h"
+#include "Texture.h"
+
+#include <glm/glm.hpp>
+
+namespace Hazel
+{
+
+// NOTE: Batches every quad of a scene into one stream vertex buffer and issues a single indexed
+// draw per batch. A batch is flushed when it runs out of quads or texture slots, or at EndScene.
+class Renderer2D
+{
+public:
+    static void Init();
+    static void Shutdown();
+
+    static void BeginScene(const OrthographicCamera& camera);
+    static void EndScene();
+    // NOTE: Draws what has been batched so far and starts a new batch
+    static void Flush();
+
+    // Primitives
+    static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
+    static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
+    static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<Texture2D>& texture,
+                         float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+    static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture,
+                         float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+
+    static void DrawQuad(const glm::mat4& transform, const glm::vec4& color);
+    static void DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor = 1.0f,
+                         const glm::vec4& tintColor = glm::vec4(1.0f));
+
+    // NOTE: Rotation is in degrees, counter-clockwise around the quad center
+    static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation,
+                                const glm::vec4& color);
+    static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
+                                const glm::vec4& color);
+    static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation,
+                                const Ref<Texture2D>& texture, float tilingFactor = 1.0f,
+                                const glm::vec4& tintColor = glm::vec4(1.0f));
+    static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
+                                const Ref<Texture2D>& texture, float tilingFactor = 1.0f,
+                                const glm::vec4& tintColor = glm::vec4(1.0f));
+};
+
+} // namespace Hazel
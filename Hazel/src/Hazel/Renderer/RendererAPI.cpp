@@ -1,9 +1,26 @@
 #include "hzpch.h"
 #include "RendererAPI.h"
 
+#include "Platform/Null/NullRendererAPI.h"
+#include "Platform/OpenGL/OpenGLRendererAPI.h"
+
 namespace Hazel
 {
 
 RendererAPI::API RendererAPI::s_API = RendererAPI::API::OpenGL;
 
+Scope<RendererAPI> RendererAPI::Create()
+{
+    switch (s_API)
+    {
+    case RendererAPI::API::None:
+        return std::make_unique<NullRendererAPI>();
+    case RendererAPI::API::OpenGL:
+        return std::make_unique<OpenGLRendererAPI>();
+    }
+
+    HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+    return nullptr;
 }
+
+} // namespace Hazel
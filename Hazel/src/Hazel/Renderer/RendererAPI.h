@@ -24,12 +24,28 @@ public:
     virtual void SetClearColor(const glm::vec4& color) = 0;
     virtual void Clear() = 0;
 
-    virtual void DrawIndexed(const Ref<VertexArray>& vertexArray) = 0;
+    virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+    // NOTE: Draws from whatever vertex array is currently bound; the caller owns the binding
+    virtual void DrawIndexed(uint32_t indexCount) = 0;
+    // NOTE: baseVertex is added to every index, e.g. to draw from a region of a stream buffer
+    virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount,
+                                       uint32_t baseVertex) = 0;
+
+    virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount,
+                                      uint32_t indexCount = 0) = 0;
+    virtual void DrawIndexedInstanced(uint32_t indexCount, uint32_t instanceCount) = 0;
 
     inline static API GetAPI()
     {
         return s_API;
     }
+    // NOTE: Must be called before Renderer::Init; resources created under one API cannot be used with another
+    inline static void SetAPI(API api)
+    {
+        s_API = api;
+    }
+
+    static Scope<RendererAPI> Create();
 
 private:
     static API s_API;
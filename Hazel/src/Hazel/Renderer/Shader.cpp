@@ -1,7 +1,9 @@
 #include "hzpch.h"
 #include "Shader.h"
 
+#include "Platform/Null/NullShader.h"
 #include "Platform/OpenGL/OpenGLShader.h"
+#include "RenderThread.h"
 #include "Renderer.h"
 
 namespace Hazel
@@ -11,10 +13,9 @@ Ref<Shader> Shader::Create(const std::string& filepath)
     switch (Renderer::GetAPI())
     {
     case RendererAPI::API::None:
-        HZ_CORE_ASSERT(false, "RendererAPI::None is not supported!");
-        return nullptr;
+        return RenderThread::CreateResource<NullShader>(filepath);
     case RendererAPI::API::OpenGL:
-        return std::make_shared<OpenGLShader>(filepath);
+        return RenderThread::CreateResource<OpenGLShader>(filepath);
     }
 
     HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -26,10 +27,9 @@ Ref<Shader> Shader::Create(const std::string& name, const std::string& vertexSou
     switch (Renderer::GetAPI())
     {
     case RendererAPI::API::None:
-        HZ_CORE_ASSERT(false, "RendererAPI::None is not supported!");
-        return nullptr;
+        return RenderThread::CreateResource<NullShader>(name, vertexSource, fragmentSource);
     case RendererAPI::API::OpenGL:
-        return std::make_shared<OpenGLShader>(name, vertexSource, fragmentSource);
+        return RenderThread::CreateResource<OpenGLShader>(name, vertexSource, fragmentSource);
     }
 
     HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
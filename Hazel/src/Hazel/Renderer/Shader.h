@@ -1,11 +1,60 @@
 #pragma once
 
+#include "Hazel/Core/Core.h"
+
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
+#include <glm/glm.hpp>
+
 namespace Hazel
 {
 
+// NOTE: Prehashed uniform name (FNV-1a). Declare handles as `static constexpr` so the hash is computed
+// at compile time and per-draw lookups never touch strings.
+struct ShaderUniform
+{
+    uint32_t Hash = 0;
+
+    constexpr ShaderUniform() = default;
+    constexpr ShaderUniform(const char* name) : Hash(HashName(name))
+    {
+    }
+    constexpr ShaderUniform(std::string_view name) : Hash(HashName(name))
+    {
+    }
+    ShaderUniform(const std::string& name) : Hash(HashName(std::string_view(name)))
+    {
+    }
+
+    static constexpr uint32_t HashName(const char* name)
+    {
+        uint32_t hash = 2166136261u;
+        for (; *name; name++)
+            hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;
+        return hash;
+    }
+
+    static constexpr uint32_t HashName(std::string_view name)
+    {
+        uint32_t hash = 2166136261u;
+        for (char c : name)
+            hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        return hash;
+    }
+
+    constexpr bool operator==(const ShaderUniform& other) const
+    {
+        return Hash == other.Hash;
+    }
+    constexpr bool operator!=(const ShaderUniform& other) const
+    {
+        return Hash != other.Hash;
+    }
+};
+
 class Shader
 {
 public:
@@ -14,7 +63,20 @@ public:
     virtual void Bind() const = 0;
     virtual void Unbind() const = 0;
 
+    virtual bool HasUniform(ShaderUniform uniform) const = 0;
+
+    // NOTE: Setters compare against a shadow copy and skip the upload when the value is unchanged
+    virtual void SetInt(ShaderUniform uniform, int value) = 0;
+    virtual void SetIntArray(ShaderUniform uniform, const int* values, uint32_t count) = 0;
+    virtual void SetFloat(ShaderUniform uniform, float value) = 0;
+    virtual void SetFloat2(ShaderUniform uniform, const glm::vec2& value) = 0;
+    virtual void SetFloat3(ShaderUniform uniform, const glm::vec3& value) = 0;
+    virtual void SetFloat4(ShaderUniform uniform, const glm::vec4& value) = 0;
+    virtual void SetMat3(ShaderUniform uniform, const glm::mat3& value) = 0;
+    virtual void SetMat4(ShaderUniform uniform, const glm::mat4& value) = 0;
+
     virtual const std::string& GetName() const = 0;
+    virtual uint32_t GetRendererID() const = 0;
 
     static Ref<Shader> Create(const std::string& filepath);
     static Ref<Shader> Create(const std::string& name, const std::string& vertexSource,
@@ -36,4 +98,4 @@ private:
 private:
     std::unordered_map<std::string, Ref<Shader>> m_Shaders;
 };
-} // namespace Hazel
\ No newline at end of file
+} // namespace Hazel
@@ -1,21 +1,36 @@
 #include "hzpch.h"
 #include "Texture.h"
 
+#include "RenderThread.h"
 #include "Renderer.h"
+#include "Platform/Null/NullTexture.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
 
 namespace Hazel
 {
 
+Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height)
+{
+    switch (Renderer::GetAPI())
+    {
+    case RendererAPI::API::None:
+        return RenderThread::CreateResource<NullTexture2D>(width, height);
+    case RendererAPI::API::OpenGL:
+        return RenderThread::CreateResource<OpenGLTexture2D>(width, height);
+    }
+
+    HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+    return nullptr;
+}
+
 Ref<Texture2D> Texture2D::Create(const std::string& path)
 {
     switch (Renderer::GetAPI())
     {
     case RendererAPI::API::None:
-        HZ_CORE_ASSERT(false, "RendererAPI::None is not supported!");
-        return nullptr;
+        return RenderThread::CreateResource<NullTexture2D>(path);
     case RendererAPI::API::OpenGL:
-        return std::make_shared<OpenGLTexture2D>(path);
+        return RenderThread::CreateResource<OpenGLTexture2D>(path);
     }
 
     HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
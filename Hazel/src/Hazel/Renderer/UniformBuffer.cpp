@@ -0,0 +1,26 @@
+#include "hzpch.h"
+#include "UniformBuffer.h"
+
+#include "RenderThread.h"
+#include "Renderer.h"
+#include "Platform/Null/NullUniformBuffer.h"
+#include "Platform/OpenGL/OpenGLUniformBuffer.h"
+
+namespace Hazel
+{
+
+Ref<UniformBuffer> UniformBuffer::Create(uint32_t size, uint32_t binding)
+{
+    switch (Renderer::GetAPI())
+    {
+    case RendererAPI::API::None:
+        return RenderThread::CreateResource<NullUniformBuffer>(size, binding);
+    case RendererAPI::API::OpenGL:
+        return RenderThread::CreateResource<OpenGLUniformBuffer>(size, binding);
+    }
+
+    HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+    return nullptr;
+}
+
+} // namespace Hazel
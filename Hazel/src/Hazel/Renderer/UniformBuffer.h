@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+#include <cstdint>
+
+namespace Hazel
+{
+
+// NOTE: Binding points shared by every shader. GLSL 330 has no layout(binding) qualifier, so shaders are
+// attached to these by uniform block name when they are reflected.
+struct UniformBufferBinding
+{
+    const char* BlockName;
+    uint32_t Binding;
+
+    static constexpr uint32_t SceneData = 0;
+};
+
+static constexpr UniformBufferBinding s_UniformBufferBindings[] = {{"SceneData", UniformBufferBinding::SceneData}};
+
+class UniformBuffer
+{
+public:
+    virtual ~UniformBuffer() = default;
+
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+    virtual uint32_t GetBinding() const = 0;
+
+    static Ref<UniformBuffer> Create(uint32_t size, uint32_t binding);
+};
+
+} // namespace Hazel
@@ -1,20 +1,21 @@
 #include "hzpch.h"
 #include "VertexArray.h"
 
+#include "Platform/Null/NullVertexArray.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
+#include "RenderThread.h"
 #include "Renderer.h"
 
 namespace Hazel
 {
-VertexArray* VertexArray::Create()
+Ref<VertexArray> VertexArray::Create()
 {
     switch (Renderer::GetAPI())
     {
     case RendererAPI::API::None:
-        HZ_CORE_ASSERT(false, "RendererAPI::None is not supported!");
-        return nullptr;
+        return RenderThread::CreateResource<NullVertexArray>();
     case RendererAPI::API::OpenGL:
-        return new OpenGLVertexArray();
+        return RenderThread::CreateResource<OpenGLVertexArray>();
     }
 
     HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
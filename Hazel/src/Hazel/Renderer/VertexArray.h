@@ -22,6 +22,8 @@ public:
     virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const = 0;
     virtual const Ref<IndexBuffer>& GetIndexBuffer() const = 0;
 
-    static VertexArray* Create();
+    virtual uint32_t GetRendererID() const = 0;
+
+    static Ref<VertexArray> Create();
 };
 } // namespace Hazel
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "hzpch.h"
+#include "NullBuffer.h"
+
+#include "NullRecorder.h"
+
+#include "Hazel/Renderer/RenderStatistics.h"
+
+#include <cstring>
+
+namespace Hazel
+{
+
+static constexpr uint32_t s_VertexBufferTarget = 0;
+static constexpr uint32_t s_IndexBufferTarget = 1;
+
+/* Vertex Buffer */
+
+NullVertexBuffer::NullVertexBuffer(uint32_t size, BufferUsage usage)
+    : m_RendererID(NullRecorder::AllocateID()), m_Usage(usage), m_Data(size)
+{
+}
+
+NullVertexBuffer::NullVertexBuffer(float* vertices, uint32_t size)
+    : m_RendererID(NullRecorder::AllocateID()), m_Data(size)
+{
+    std::memcpy(m_Data.data(), vertices, size);
+    NullRecorder::Record(NullRecorder::CommandType::UploadBuffer, m_RendererID, size);
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, size);
+}
+
+void NullVertexBuffer::Bind() const
+{
+    NullRecorder::Record(NullRecorder::CommandType::BindBuffer, s_VertexBufferTarget, m_RendererID);
+}
+
+void NullVertexBuffer::Unbind() const
+{
+    NullRecorder::Record(NullRecorder::CommandType::BindBuffer, s_VertexBufferTarget, 0);
+}
+
+void NullVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+{
+    HZ_CORE_ASSERT(offset + size <= m_Data.size(), "Vertex buffer write out of range!");
+
+    std::memcpy(m_Data.data() + offset, data, size);
+    NullRecorder::Record(NullRecorder::CommandType::UploadBuffer, m_RendererID, size, offset);
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, size);
+}
+
+void* NullVertexBuffer::Map()
+{
+    HZ_CORE_ASSERT(m_Usage == BufferUsage::Stream, "Only stream buffers can be mapped!");
+    HZ_CORE_ASSERT(!m_Mapped, "Vertex buffer is already mapped!");
+    m_Mapped = true;
+
+    return m_Data.data();
+}
+
+void NullVertexBuffer::Unmap(uint32_t size)
+{
+    HZ_CORE_ASSERT(m_Mapped, "Vertex buffer is not mapped!");
+    m_Mapped = false;
+
+    if (size == 0)
+        return;
+
+    NullRecorder::Record(NullRecorder::CommandType::UploadBuffer, m_RendererID, size);
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, size);
+}
+
+/* Index Buffer */
+
+NullIndexBuffer::NullIndexBuffer(uint32_t count, BufferUsage usage)
+    : m_RendererID(NullRecorder::AllocateID()), m_Indices(count)
+{
+}
+
+NullIndexBuffer::NullIndexBuffer(uint32_t* indices, uint32_t count)
+    : m_RendererID(NullRecorder::AllocateID()), m_Indices(indices, indices + count)
+{
+    NullRecorder::Record(NullRecorder::CommandType::UploadBuffer, m_RendererID, count * sizeof(uint32_t));
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, count * sizeof(uint32_t));
+}
+
+void NullIndexBuffer::Bind() const
+{
+    NullRecorder::Record(NullRecorder::CommandType::BindBuffer, s_IndexBufferTarget, m_RendererID);
+}
+
+void NullIndexBuffer::Unbind() const
+{
+    NullRecorder::Record(NullRecorder::CommandType::BindBuffer, s_IndexBufferTarget, 0);
+}
+
+void NullIndexBuffer::SetData(const uint32_t* indices, uint32_t count, uint32_t offset)
+{
+    HZ_CORE_ASSERT(offset + count <= m_Indices.size(), "Index buffer write out of range!");
+
+    std::memcpy(m_Indices.data() + offset, indices, count * sizeof(uint32_t));
+    NullRecorder::Record(NullRecorder::CommandType::UploadBuffer, m_RendererID, count * sizeof(uint32_t),
+                         offset * sizeof(uint32_t));
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, count * sizeof(uint32_t));
+}
+
+} // namespace Hazel
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Hazel/Renderer/Buffer.h"
+
+#include <vector>
+
+namespace Hazel
+{
+
+// NOTE: Keeps a CPU copy of the contents so uploads cost a memcpy, roughly what a driver does on the GL path
+class NullVertexBuffer : public VertexBuffer
+{
+public:
+    NullVertexBuffer(uint32_t size, BufferUsage usage);
+    NullVertexBuffer(float* vertices, uint32_t size);
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+    virtual void* Map() override;
+    virtual void Unmap(uint32_t size) override;
+    virtual uint32_t GetMappedOffset() const override
+    {
+        return 0;
+    }
+
+    virtual uint32_t GetSize() const override
+    {
+        return static_cast<uint32_t>(m_Data.size());
+    }
+    virtual BufferUsage GetUsage() const override
+    {
+        return m_Usage;
+    }
+
+    virtual const BufferLayout& GetLayout() const override
+    {
+        return m_Layout;
+    }
+    virtual void SetLayout(const BufferLayout& layout) override
+    {
+        m_Layout = layout;
+    }
+
+private:
+    uint32_t m_RendererID = 0;
+    BufferUsage m_Usage = BufferUsage::Static;
+    BufferLayout m_Layout;
+    std::vector<uint8_t> m_Data;
+    bool m_Mapped = false;
+};
+
+class NullIndexBuffer : public IndexBuffer
+{
+public:
+    NullIndexBuffer(uint32_t count, BufferUsage usage);
+    NullIndexBuffer(uint32_t* indices, uint32_t count);
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+
+    virtual void SetData(const uint32_t* indices, uint32_t count, uint32_t offset = 0) override;
+
+    virtual uint32_t GetCount() const override
+    {
+        return static_cast<uint32_t>(m_Indices.size());
+    }
+
+private:
+    uint32_t m_RendererID = 0;
+    std::vector<uint32_t> m_Indices;
+};
+
+} // namespace Hazel
@@ -0,0 +1,33 @@
+#include "hzpch.h"
+#include "NullGPUTimerQueries.h"
+
+#include <chrono>
+
+namespace Hazel
+{
+
+NullGPUTimerQueries::NullGPUTimerQueries(uint32_t frameCount) : m_Timestamps(frameCount)
+{
+}
+
+void NullGPUTimerQueries::WriteTimestamp(uint32_t frame, uint32_t index)
+{
+    std::vector<uint64_t>& timestamps = m_Timestamps[frame];
+    if (index >= timestamps.size())
+        timestamps.resize(index + 1);
+
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    timestamps[index] = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+bool NullGPUTimerQueries::ReadTimestamps(uint32_t frame, uint32_t count, uint64_t* nanoseconds)
+{
+    const std::vector<uint64_t>& timestamps = m_Timestamps[frame];
+    if (count == 0 || count > timestamps.size())
+        return false;
+
+    std::copy(timestamps.begin(), timestamps.begin() + count, nanoseconds);
+    return true;
+}
+
+} // namespace Hazel
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Hazel/Renderer/GPUTimerQueries.h"
+
+#include <vector>
+
+namespace Hazel
+{
+
+// NOTE: There is no GPU, so timestamps are CPU clock readings taken when the null backend reaches them.
+// Results resolve immediately; in a headless run they show where the renderer spends CPU time.
+class NullGPUTimerQueries : public GPUTimerQueries
+{
+public:
+    NullGPUTimerQueries(uint32_t frameCount);
+
+    virtual void WriteTimestamp(uint32_t frame, uint32_t index) override;
+    virtual bool ReadTimestamps(uint32_t frame, uint32_t count, uint64_t* nanoseconds) override;
+
+private:
+    std::vector<std::vector<uint64_t>> m_Timestamps;
+};
+
+} // namespace Hazel
@@ -0,0 +1,200 @@
+#include "hzpch.h"
+#include "NullRecorder.h"
+
+#include <array>
+#include <sstream>
+#include <string>
+
+namespace Hazel
+{
+
+static constexpr uint32_t s_MaxTextureSlots = 32;
+
+// NOTE: Shadow of the bound objects plus the counters they feed. Both live recording and replay go through
+// Apply so a replayed log reproduces the recorded statistics exactly.
+struct NullDeviceState
+{
+    uint32_t Shader = 0;
+    uint32_t VertexArray = 0;
+    std::array<uint32_t, 2> Buffers = {};
+    std::array<uint32_t, s_MaxTextureSlots> Textures = {};
+
+    NullRecorder::Statistics Stats;
+
+    void Bind(uint32_t& bound, uint32_t object)
+    {
+        if (bound == object)
+            return;
+
+        bound = object;
+        Stats.StateChanges++;
+    }
+
+    void Apply(const NullRecorder::Command& command)
+    {
+        using CommandType = NullRecorder::CommandType;
+
+        const uint32_t* args = command.Arguments;
+        Stats.Commands++;
+        switch (command.Type)
+        {
+        case CommandType::BindShader:
+            Bind(Shader, args[0]);
+            break;
+        case CommandType::BindVertexArray:
+            Bind(VertexArray, args[0]);
+            break;
+        case CommandType::BindBuffer:
+            Bind(Buffers[args[0] % Buffers.size()], args[1]);
+            break;
+        case CommandType::BindTexture:
+            Bind(Textures[args[0] % s_MaxTextureSlots], args[1]);
+            break;
+        case CommandType::SetUniform:
+            Stats.UniformUploads++;
+            Stats.BytesUploaded += args[1];
+            break;
+        case CommandType::UploadBuffer:
+            Stats.BytesUploaded += args[1];
+            break;
+        case CommandType::UploadTexture:
+            Stats.BytesUploaded += args[1];
+            break;
+        case CommandType::Draw:
+            Stats.DrawCalls++;
+            Stats.Indices += static_cast<uint64_t>(args[0]) * args[1];
+            Stats.Instances += args[1];
+            break;
+        default:
+            break;
+        }
+    }
+};
+
+static NullDeviceState s_State;
+static std::vector<NullRecorder::Command> s_Log;
+static bool s_Logging = false;
+static uint32_t s_NextID = 1;
+
+static const char* s_CommandNames[] = {"SetViewport", "SetClearColor", "Clear",        "BindShader",
+                                       "BindVertexArray", "BindBuffer", "BindTexture",  "SetUniform",
+                                       "UploadBuffer", "UploadTexture", "Draw"};
+static_assert(sizeof(s_CommandNames) / sizeof(s_CommandNames[0]) ==
+                  static_cast<size_t>(NullRecorder::CommandType::Count),
+              "Every null command needs a name!");
+
+void NullRecorder::Record(CommandType type, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    Command command;
+    command.Type = type;
+    command.Arguments[0] = a0;
+    command.Arguments[1] = a1;
+    command.Arguments[2] = a2;
+    command.Arguments[3] = a3;
+
+    s_State.Apply(command);
+    if (s_Logging)
+        s_Log.push_back(command);
+}
+
+uint32_t NullRecorder::AllocateID()
+{
+    return s_NextID++;
+}
+
+NullRecorder::Statistics NullRecorder::GetStatistics()
+{
+    return s_State.Stats;
+}
+
+void NullRecorder::ResetStatistics()
+{
+    s_State = NullDeviceState();
+}
+
+void NullRecorder::SetLogging(bool enabled)
+{
+    s_Logging = enabled;
+}
+
+bool NullRecorder::IsLogging()
+{
+    return s_Logging;
+}
+
+const std::vector<NullRecorder::Command>& NullRecorder::GetLog()
+{
+    return s_Log;
+}
+
+void NullRecorder::ClearLog()
+{
+    s_Log.clear();
+}
+
+void NullRecorder::WriteLog(std::ostream& stream, const std::vector<Command>& commands)
+{
+    for (const Command& command : commands)
+    {
+        stream << CommandTypeToString(command.Type);
+        for (uint32_t argument : command.Arguments)
+            stream << ' ' << argument;
+        stream << '\n';
+    }
+}
+
+bool NullRecorder::ReadLog(std::istream& stream, std::vector<Command>& commands)
+{
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        if (line.empty())
+            continue;
+
+        std::istringstream lineStream(line);
+        std::string name;
+        lineStream >> name;
+
+        Command command;
+        bool known = false;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(CommandType::Count); i++)
+        {
+            if (name == s_CommandNames[i])
+            {
+                command.Type = static_cast<CommandType>(i);
+                known = true;
+                break;
+            }
+        }
+
+        if (!known)
+            return false;
+
+        for (uint32_t& argument : command.Arguments)
+        {
+            if (!(lineStream >> argument))
+                return false;
+        }
+
+        commands.push_back(command);
+    }
+
+    return true;
+}
+
+NullRecorder::Statistics NullRecorder::Replay(const std::vector<Command>& commands)
+{
+    NullDeviceState state;
+    for (const Command& command : commands)
+        state.Apply(command);
+
+    return state.Stats;
+}
+
+const char* NullRecorder::CommandTypeToString(CommandType type)
+{
+    const uint32_t index = static_cast<uint32_t>(type);
+    return index < static_cast<uint32_t>(CommandType::Count) ? s_CommandNames[index] : "Unknown";
+}
+
+} // namespace Hazel
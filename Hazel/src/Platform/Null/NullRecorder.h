@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace Hazel
+{
+
+// NOTE: Sink for everything the null (RendererAPI::API::None) backend is asked to do. Statistics are always
+// kept; the command log is opt-in. Bind commands only count as state changes when they change the bound
+// object, matching what OpenGLStateCache lets through on the GL path.
+//
+// A written log can be read back and replayed, which rebuilds the same statistics without running the
+// renderer, e.g. to compare a CI run against a recorded baseline.
+class NullRecorder
+{
+public:
+    enum class CommandType : uint8_t
+    {
+        SetViewport = 0, // x, y, width, height
+        SetClearColor,   // r, g, b, a as float bits
+        Clear,           //
+        BindShader,      // shader
+        BindVertexArray, // vertex array
+        BindBuffer,      // target (0 = vertex, 1 = index), buffer
+        BindTexture,     // slot, texture
+        SetUniform,      // uniform hash, size
+        UploadBuffer,    // buffer, size, offset
+        UploadTexture,   // texture, size
+        Draw,            // index count, instance count, base vertex
+
+        Count
+    };
+
+    static constexpr uint32_t MaxArguments = 4;
+
+    struct Command
+    {
+        CommandType Type = CommandType::Clear;
+        uint32_t Arguments[MaxArguments] = {};
+    };
+
+    struct Statistics
+    {
+        uint32_t Commands = 0;
+        uint32_t DrawCalls = 0;
+        uint64_t Indices = 0;
+        uint64_t Instances = 0;
+        uint32_t StateChanges = 0;
+        uint32_t UniformUploads = 0;
+        uint64_t BytesUploaded = 0;
+    };
+
+    static void Record(CommandType type, uint32_t a0 = 0, uint32_t a1 = 0, uint32_t a2 = 0, uint32_t a3 = 0);
+
+    // NOTE: Renderer IDs for null resources; never 0 so they are distinguishable from "nothing bound"
+    static uint32_t AllocateID();
+
+    static Statistics GetStatistics();
+    // NOTE: Also forgets the bound state, so the first bind of each kind afterwards counts as a change
+    static void ResetStatistics();
+
+    static void SetLogging(bool enabled);
+    static bool IsLogging();
+    static const std::vector<Command>& GetLog();
+    static void ClearLog();
+
+    // NOTE: One command per line: the command name followed by its arguments
+    static void WriteLog(std::ostream& stream, const std::vector<Command>& commands);
+    static bool ReadLog(std::istream& stream, std::vector<Command>& commands);
+    static Statistics Replay(const std::vector<Command>& commands);
+
+    static const char* CommandTypeToString(CommandType type);
+};
+
+} // namespace Hazel
@@ -0,0 +1,75 @@
+#include "hzpch.h"
+#include "NullRendererAPI.h"
+
+#include "NullRecorder.h"
+
+#include <glm/glm.hpp>
+
+#include <cstring>
+
+namespace Hazel
+{
+
+static uint32_t FloatBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static uint32_t GetIndexCount(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
+{
+    return indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+}
+
+void NullRendererAPI::Init()
+{
+}
+
+void NullRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    NullRecorder::Record(NullRecorder::CommandType::SetViewport, x, y, width, height);
+}
+
+void NullRendererAPI::SetClearColor(const glm::vec4& color)
+{
+    NullRecorder::Record(NullRecorder::CommandType::SetClearColor, FloatBits(color.r), FloatBits(color.g),
+                         FloatBits(color.b), FloatBits(color.a));
+}
+
+void NullRendererAPI::Clear()
+{
+    NullRecorder::Record(NullRecorder::CommandType::Clear);
+}
+
+void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
+{
+    vertexArray->Bind();
+    DrawIndexed(GetIndexCount(vertexArray, indexCount));
+}
+
+void NullRendererAPI::DrawIndexed(uint32_t indexCount)
+{
+    NullRecorder::Record(NullRecorder::CommandType::Draw, indexCount, 1);
+}
+
+void NullRendererAPI::DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount,
+                                            uint32_t baseVertex)
+{
+    vertexArray->Bind();
+    NullRecorder::Record(NullRecorder::CommandType::Draw, indexCount, 1, baseVertex);
+}
+
+void NullRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount,
+                                           uint32_t indexCount)
+{
+    vertexArray->Bind();
+    DrawIndexedInstanced(GetIndexCount(vertexArray, indexCount), instanceCount);
+}
+
+void NullRendererAPI::DrawIndexedInstanced(uint32_t indexCount, uint32_t instanceCount)
+{
+    NullRecorder::Record(NullRecorder::CommandType::Draw, indexCount, instanceCount);
+}
+
+} // namespace Hazel
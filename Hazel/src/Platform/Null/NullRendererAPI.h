@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Hazel/Renderer/RendererAPI.h"
+
+namespace Hazel
+{
+
+// NOTE: Backend for RendererAPI::API::None. Needs no context; every call is forwarded to NullRecorder.
+class NullRendererAPI : public RendererAPI
+{
+public:
+    virtual void Init() override;
+    virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+    virtual void SetClearColor(const glm::vec4& color) override;
+    virtual void Clear() override;
+
+    virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+    virtual void DrawIndexed(uint32_t indexCount) override;
+    virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount,
+                                       uint32_t baseVertex) override;
+
+    virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount,
+                                      uint32_t indexCount = 0) override;
+    virtual void DrawIndexedInstanced(uint32_t indexCount, uint32_t instanceCount) override;
+};
+
+} // namespace Hazel
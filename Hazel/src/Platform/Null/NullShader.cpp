@@ -0,0 +1,86 @@
+#include "hzpch.h"
+#include "NullShader.h"
+
+#include "NullRecorder.h"
+
+#include "Hazel/Renderer/RenderStatistics.h"
+
+namespace Hazel
+{
+
+NullShader::NullShader(const std::string& filepath) : m_RendererID(NullRecorder::AllocateID())
+{
+    // NOTE: Same naming rule as OpenGLShader, so ShaderLibrary lookups behave identically
+    size_t lastSlash = filepath.find_last_of("/\\");
+    lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+    size_t lastDot = filepath.rfind('.');
+    m_Name = filepath.substr(lastSlash, lastDot - lastSlash);
+}
+
+NullShader::NullShader(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource)
+    : m_RendererID(NullRecorder::AllocateID()), m_Name(name)
+{
+}
+
+void NullShader::Bind() const
+{
+    NullRecorder::Record(NullRecorder::CommandType::BindShader, m_RendererID);
+    RenderCounters::Add(RenderCounters::Counter::ShaderBinds);
+}
+
+void NullShader::Unbind() const
+{
+    NullRecorder::Record(NullRecorder::CommandType::BindShader, 0);
+}
+
+bool NullShader::HasUniform(ShaderUniform uniform) const
+{
+    return true;
+}
+
+void NullShader::RecordUniform(ShaderUniform uniform, uint32_t size)
+{
+    NullRecorder::Record(NullRecorder::CommandType::SetUniform, uniform.Hash, size);
+}
+
+void NullShader::SetInt(ShaderUniform uniform, int value)
+{
+    RecordUniform(uniform, sizeof(int));
+}
+
+void NullShader::SetIntArray(ShaderUniform uniform, const int* values, uint32_t count)
+{
+    RecordUniform(uniform, count * sizeof(int));
+}
+
+void NullShader::SetFloat(ShaderUniform uniform, float value)
+{
+    RecordUniform(uniform, sizeof(float));
+}
+
+void NullShader::SetFloat2(ShaderUniform uniform, const glm::vec2& value)
+{
+    RecordUniform(uniform, sizeof(glm::vec2));
+}
+
+void NullShader::SetFloat3(ShaderUniform uniform, const glm::vec3& value)
+{
+    RecordUniform(uniform, sizeof(glm::vec3));
+}
+
+void NullShader::SetFloat4(ShaderUniform uniform, const glm::vec4& value)
+{
+    RecordUniform(uniform, sizeof(glm::vec4));
+}
+
+void NullShader::SetMat3(ShaderUniform uniform, const glm::mat3& value)
+{
+    RecordUniform(uniform, sizeof(glm::mat3));
+}
+
+void NullShader::SetMat4(ShaderUniform uniform, const glm::mat4& value)
+{
+    RecordUniform(uniform, sizeof(glm::mat4));
+}
+
+} // namespace Hazel
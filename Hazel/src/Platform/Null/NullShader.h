@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Hazel/Renderer/Shader.h"
+
+namespace Hazel
+{
+
+// NOTE: Never reads or compiles source, so shaders load even when the asset directory is missing. There is
+// no reflection either: every uniform is reported present and each set is recorded with its size.
+class NullShader : public Shader
+{
+public:
+    NullShader(const std::string& filepath);
+    NullShader(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource);
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+
+    virtual bool HasUniform(ShaderUniform uniform) const override;
+
+    virtual void SetInt(ShaderUniform uniform, int value) override;
+    virtual void SetIntArray(ShaderUniform uniform, const int* values, uint32_t count) override;
+    virtual void SetFloat(ShaderUniform uniform, float value) override;
+    virtual void SetFloat2(ShaderUniform uniform, const glm::vec2& value) override;
+    virtual void SetFloat3(ShaderUniform uniform, const glm::vec3& value) override;
+    virtual void SetFloat4(ShaderUniform uniform, const glm::vec4& value) override;
+    virtual void SetMat3(ShaderUniform uniform, const glm::mat3& value) override;
+    virtual void SetMat4(ShaderUniform uniform, const glm::mat4& value) override;
+
+    virtual const std::string& GetName() const override
+    {
+        return m_Name;
+    }
+    virtual uint32_t GetRendererID() const override
+    {
+        return m_RendererID;
+    }
+
+private:
+    void RecordUniform(ShaderUniform uniform, uint32_t size);
+
+private:
+    uint32_t m_RendererID = 0;
+    std::string m_Name;
+};
+
+} // namespace Hazel
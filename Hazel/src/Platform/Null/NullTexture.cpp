@@ -0,0 +1,45 @@
+#include "hzpch.h"
+#include "NullTexture.h"
+
+#include "NullRecorder.h"
+
+#include "Hazel/Renderer/RenderStatistics.h"
+
+#include "stb_image.h"
+
+namespace Hazel
+{
+
+NullTexture2D::NullTexture2D(uint32_t width, uint32_t height)
+    : m_RendererID(NullRecorder::AllocateID()), m_Width(width), m_Height(height)
+{
+}
+
+NullTexture2D::NullTexture2D(const std::string& path) : m_RendererID(NullRecorder::AllocateID())
+{
+    int width, height, channels = 0;
+    if (stbi_info(path.c_str(), &width, &height, &channels))
+    {
+        m_Width = static_cast<uint32_t>(width);
+        m_Height = static_cast<uint32_t>(height);
+    }
+
+    // NOTE: Counted like OpenGLTexture2D, which uploads the image in its own channel count
+    const uint64_t bytes = static_cast<uint64_t>(m_Width) * m_Height * channels;
+    NullRecorder::Record(NullRecorder::CommandType::UploadTexture, m_RendererID, static_cast<uint32_t>(bytes));
+    RenderCounters::Add(RenderCounters::Counter::TextureBytesUploaded, bytes);
+}
+
+void NullTexture2D::SetData(void* data, uint32_t size)
+{
+    NullRecorder::Record(NullRecorder::CommandType::UploadTexture, m_RendererID, size);
+    RenderCounters::Add(RenderCounters::Counter::TextureBytesUploaded, size);
+}
+
+void NullTexture2D::Bind(uint32_t slot) const
+{
+    NullRecorder::Record(NullRecorder::CommandType::BindTexture, slot, m_RendererID);
+    RenderCounters::Add(RenderCounters::Counter::TextureBinds);
+}
+
+} // namespace Hazel
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Hazel/Renderer/Texture.h"
+
+namespace Hazel
+{
+
+class NullTexture2D : public Texture2D
+{
+public:
+    NullTexture2D(uint32_t width, uint32_t height);
+    // NOTE: Only the image header is read, for the size; a missing file yields a 1x1 texture
+    NullTexture2D(const std::string& path);
+
+    virtual uint32_t GetWidth() const override
+    {
+        return m_Width;
+    }
+    virtual uint32_t GetHeight() const override
+    {
+        return m_Height;
+    }
+    virtual uint32_t GetRendererID() const override
+    {
+        return m_RendererID;
+    }
+
+    virtual void SetData(void* data, uint32_t size) override;
+
+    virtual void Bind(uint32_t slot = 0) const override;
+
+private:
+    uint32_t m_RendererID = 0;
+    uint32_t m_Width = 1;
+    uint32_t m_Height = 1;
+};
+
+} // namespace Hazel
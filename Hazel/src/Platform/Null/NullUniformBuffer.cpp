@@ -0,0 +1,24 @@
+#include "hzpch.h"
+#include "NullUniformBuffer.h"
+
+#include "NullRecorder.h"
+
+#include "Hazel/Renderer/RenderStatistics.h"
+
+namespace Hazel
+{
+
+NullUniformBuffer::NullUniformBuffer(uint32_t size, uint32_t binding)
+    : m_RendererID(NullRecorder::AllocateID()), m_Size(size), m_Binding(binding)
+{
+}
+
+void NullUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+{
+    HZ_CORE_ASSERT(offset + size <= m_Size, "Uniform buffer write out of range!");
+
+    NullRecorder::Record(NullRecorder::CommandType::UploadBuffer, m_RendererID, size, offset);
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, size);
+}
+
+} // namespace Hazel
@@ -0,0 +1,37 @@
+#include "hzpch.h"
+#include "NullVertexArray.h"
+
+#include "NullRecorder.h"
+
+#include "Hazel/Renderer/RenderStatistics.h"
+
+namespace Hazel
+{
+
+NullVertexArray::NullVertexArray() : m_RendererID(NullRecorder::AllocateID())
+{
+}
+
+void NullVertexArray::Bind() const
+{
+    NullRecorder::Record(NullRecorder::CommandType::BindVertexArray, m_RendererID);
+    RenderCounters::Add(RenderCounters::Counter::VertexArrayBinds);
+}
+
+void NullVertexArray::Unbind() const
+{
+    NullRecorder::Record(NullRecorder::CommandType::BindVertexArray, 0);
+}
+
+void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+{
+    HZ_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+    m_VertexBuffers.push_back(vertexBuffer);
+}
+
+void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
+{
+    m_IndexBuffer = indexBuffer;
+}
+
+} // namespace Hazel
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Hazel/Renderer/VertexArray.h"
+
+namespace Hazel
+{
+
+class NullVertexArray : public VertexArray
+{
+public:
+    NullVertexArray();
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+
+    virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+    virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
+
+    virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override
+    {
+        return m_VertexBuffers;
+    }
+    virtual const Ref<IndexBuffer>& GetIndexBuffer() const override
+    {
+        return m_IndexBuffer;
+    }
+
+    virtual uint32_t GetRendererID() const override
+    {
+        return m_RendererID;
+    }
+
+private:
+    uint32_t m_RendererID = 0;
+    std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+    Ref<IndexBuffer> m_IndexBuffer;
+};
+
+} // namespace Hazel
@@ -0,0 +1,44 @@
+#include "hzpch.h"
+#include "NullWindow.h"
+
+#include <chrono>
+
+namespace Hazel
+{
+
+NullWindow::NullWindow(const WindowProps& props) : m_Width(props.Width), m_Height(props.Height)
+{
+}
+
+void NullWindow::OnUpdate()
+{
+}
+
+// NOTE: Nothing ever arrives, so this waits out the timeout unless woken
+void NullWindow::WaitEvents(double timeoutSeconds)
+{
+    std::unique_lock<std::mutex> lock(m_WakeMutex);
+    m_WakeCondition.wait_for(lock, std::chrono::duration<double>(timeoutSeconds), [this]() { return m_WakeRequested; });
+    m_WakeRequested = false;
+}
+
+void NullWindow::Wake()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_WakeRequested = true;
+    }
+    m_WakeCondition.notify_one();
+}
+
+void NullWindow::SetVSync(bool enabled)
+{
+    m_VSync = enabled;
+}
+
+bool NullWindow::IsVSync() const
+{
+    return m_VSync;
+}
+
+} // namespace Hazel
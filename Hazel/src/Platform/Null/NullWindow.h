@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Hazel/Core/Window.h"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace Hazel
+{
+
+// NOTE: Window for headless runs. Owns no OS window or graphics context and never produces events; it only
+// keeps the requested size so the renderer sees a sensible viewport.
+class NullWindow : public Window
+{
+public:
+    NullWindow(const WindowProps& props);
+
+    void OnUpdate() override;
+    void WaitEvents(double timeoutSeconds) override;
+    void Wake() override;
+
+    inline unsigned int GetWidth() const override
+    {
+        return m_Width;
+    }
+    inline unsigned int GetHeight() const override
+    {
+        return m_Height;
+    }
+
+    inline void SetEventCallback(const EventCallbackFn& callback) override
+    {
+        m_EventCallback = callback;
+    }
+    void SetVSync(bool enabled) override;
+    bool IsVSync() const override;
+
+    inline virtual void* GetNativeWindow() const override
+    {
+        return nullptr;
+    }
+
+private:
+    unsigned int m_Width, m_Height;
+    bool m_VSync = false;
+    EventCallbackFn m_EventCallback;
+
+    std::mutex m_WakeMutex;
+    std::condition_variable m_WakeCondition;
+    bool m_WakeRequested = false;
+};
+
+} // namespace Hazel
@@ -1,8 +1,14 @@
 #include "hzpch.h"
 #include "OpenGLBuffer.h"
 
+#include "Hazel/Renderer/RenderStatistics.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "OpenGLStateCache.h"
+
 #include <glad/glad.h>
 
+#include <cstring>
+
 namespace Hazel
 {
 static void CreateBuffer(GLuint& rendererID)
@@ -16,51 +22,242 @@ static void CreateBuffer(GLuint& rendererID)
     glGenBuffers(1, &rendererID);
 }
 
+static bool SupportsNamedBuffers()
+{
+    return GLAD_GL_VERSION_4_5 && glNamedBufferSubData;
+}
+
+static bool SupportsPersistentMapping()
+{
+    return GLAD_GL_VERSION_4_4 && glBufferStorage && glMapBufferRange && glFenceSync && glClientWaitSync;
+}
+
+static GLenum ToOpenGLUsage(BufferUsage usage)
+{
+    switch (usage)
+    {
+    case BufferUsage::Static:
+        return GL_STATIC_DRAW;
+    case BufferUsage::Dynamic:
+        return GL_DYNAMIC_DRAW;
+    case BufferUsage::Stream:
+        return GL_STREAM_DRAW;
+    }
+
+    HZ_CORE_ASSERT(false, "Unknown BufferUsage!");
+    return GL_DYNAMIC_DRAW;
+}
+
+static void WaitForFence(void*& fence)
+{
+    if (!fence)
+        return;
+
+    GLsync sync = static_cast<GLsync>(fence);
+    for (;;)
+    {
+        GLenum result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+            break;
+    }
+
+    glDeleteSync(sync);
+    fence = nullptr;
+}
+
 /* Vertex Buffer */
 
-OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
+OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size, BufferUsage usage) : m_Size(size), m_Usage(usage)
+{
+    // NOTE: Waiting on a fence has to happen before Map returns, which a queued render thread cannot do
+    // without stalling the frame, so threaded rendering always takes the orphaning path
+    const bool persistent = usage == BufferUsage::Stream && !RenderThread::IsRunning();
+
+    RenderThread::SubmitAndWait([this, persistent]() {
+        CreateBuffer(m_RendererID);
+        OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+
+        if (persistent && SupportsPersistentMapping())
+        {
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            const GLsizeiptr storageSize = static_cast<GLsizeiptr>(m_Size) * RingRegionCount;
+            glBufferStorage(GL_ARRAY_BUFFER, storageSize, nullptr, flags);
+            m_MappedBase = static_cast<uint8_t*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, storageSize, flags));
+            return;
+        }
+
+        glBufferData(GL_ARRAY_BUFFER, m_Size, nullptr, ToOpenGLUsage(m_Usage));
+    });
+
+    if (m_Usage == BufferUsage::Stream && !m_MappedBase)
+        m_Staging.resize(m_Size);
+}
+
+OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size) : m_Size(size)
 {
-    CreateBuffer(m_RendererID);
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-    glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, size);
+    RenderThread::SubmitAndWait([this, vertices, size]() {
+        CreateBuffer(m_RendererID);
+        OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+    });
 }
 
 OpenGLVertexBuffer::~OpenGLVertexBuffer()
 {
+    if (m_MappedBase)
+    {
+        for (void*& fence : m_RegionFences)
+        {
+            if (fence)
+                glDeleteSync(static_cast<GLsync>(fence));
+        }
+
+        OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+
     glDeleteBuffers(1, &m_RendererID);
+    OpenGLStateCache::OnBufferDeleted(m_RendererID);
 }
 
 void OpenGLVertexBuffer::Bind() const
 {
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    RenderThread::Submit([this]() { OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_RendererID); });
 }
 
 void OpenGLVertexBuffer::Unbind() const
 {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    RenderThread::Submit([]() { OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, 0); });
+}
+
+void OpenGLVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+{
+    HZ_CORE_ASSERT(offset + size <= m_Size, "Vertex buffer write out of range!");
+
+    if (m_Usage == BufferUsage::Stream)
+    {
+        HZ_CORE_ASSERT(offset == 0, "Stream buffers are rewritten from the start!");
+        if (m_MappedBase)
+        {
+            std::memcpy(Map(), data, size);
+            Unmap(size);
+            return;
+        }
+    }
+
+    // NOTE: Stream buffers are orphaned first so the driver hands out fresh storage instead of waiting for
+    // draws that still read the old contents
+    const bool orphan = m_Usage == BufferUsage::Stream;
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, size);
+    const void* frameData = RenderThread::CopyFrameData(data, size);
+    RenderThread::Submit([this, frameData, size, offset, orphan]() {
+        OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        if (orphan)
+            glBufferData(GL_ARRAY_BUFFER, m_Size, nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, offset, size, frameData);
+    });
+}
+
+void* OpenGLVertexBuffer::Map()
+{
+    HZ_CORE_ASSERT(m_Usage == BufferUsage::Stream, "Only stream buffers can be mapped!");
+    HZ_CORE_ASSERT(!m_Mapped, "Vertex buffer is already mapped!");
+    m_Mapped = true;
+
+    if (!m_MappedBase)
+        return m_Staging.data();
+
+    // NOTE: Every draw that reads the current region was issued before this call, so a fence inserted now
+    // covers all of them. The next region is reused only once its own fence has signalled.
+    if (m_RegionUsed)
+    {
+        RenderThread::SubmitAndWait([this]() {
+            m_RegionFences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            m_Region = (m_Region + 1) % RingRegionCount;
+            WaitForFence(m_RegionFences[m_Region]);
+        });
+        m_RegionUsed = false;
+    }
+
+    return m_MappedBase + m_Region * m_Size;
+}
+
+void OpenGLVertexBuffer::Unmap(uint32_t size)
+{
+    HZ_CORE_ASSERT(m_Mapped, "Vertex buffer is not mapped!");
+    HZ_CORE_ASSERT(size <= m_Size, "Vertex buffer write out of range!");
+    m_Mapped = false;
+
+    if (size == 0)
+        return;
+
+    // NOTE: The mapping is coherent, so writes are visible to the GPU without an explicit flush
+    if (m_MappedBase)
+    {
+        RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, size);
+        m_RegionUsed = true;
+        return;
+    }
+
+    SetData(m_Staging.data(), size);
 }
 
 /* Index Buffer */
 
+OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t count, BufferUsage usage) : m_Count(count), m_Usage(usage)
+{
+    RenderThread::SubmitAndWait([this]() {
+        CreateBuffer(m_RendererID);
+        OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_Count * sizeof(uint32_t), nullptr, ToOpenGLUsage(m_Usage));
+    });
+}
+
 OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count) : m_Count(count)
 {
-    CreateBuffer(m_RendererID);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, count * sizeof(uint32_t));
+    RenderThread::SubmitAndWait([this, indices, count]() {
+        CreateBuffer(m_RendererID);
+        OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+    });
 }
 
 OpenGLIndexBuffer::~OpenGLIndexBuffer()
 {
     glDeleteBuffers(1, &m_RendererID);
+    OpenGLStateCache::OnBufferDeleted(m_RendererID);
 }
 
 void OpenGLIndexBuffer::Bind() const
 {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+    RenderThread::Submit([this]() { OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID); });
 }
 
 void OpenGLIndexBuffer::Unbind() const
 {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    RenderThread::Submit([]() { OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); });
+}
+
+void OpenGLIndexBuffer::SetData(const uint32_t* indices, uint32_t count, uint32_t offset)
+{
+    HZ_CORE_ASSERT(offset + count <= m_Count, "Index buffer write out of range!");
+
+    const uint32_t size = count * sizeof(uint32_t);
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, size);
+    const void* frameData = RenderThread::CopyFrameData(indices, size);
+    RenderThread::Submit([this, frameData, size, offset]() {
+        if (SupportsNamedBuffers())
+        {
+            glNamedBufferSubData(m_RendererID, offset * sizeof(uint32_t), size, frameData);
+            return;
+        }
+
+        // NOTE: The element array binding is vertex array state; unbind first so no vertex array picks this up
+        OpenGLStateCache::BindVertexArray(0);
+        OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset * sizeof(uint32_t), size, frameData);
+    });
 }
 } // namespace Hazel
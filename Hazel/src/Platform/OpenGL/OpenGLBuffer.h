@@ -2,18 +2,42 @@
 
 #include "Hazel/Renderer/Buffer.h"
 
+#include <vector>
+
 namespace Hazel
 {
 
 class OpenGLVertexBuffer : public VertexBuffer
 {
 public:
+    // NOTE: Frames the GPU may still be reading from a persistently mapped stream buffer
+    static constexpr uint32_t RingRegionCount = 3;
+
+    OpenGLVertexBuffer(uint32_t size, BufferUsage usage);
     OpenGLVertexBuffer(float* vertices, uint32_t size);
     virtual ~OpenGLVertexBuffer() override;
 
     virtual void Bind() const override;
     virtual void Unbind() const override;
 
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+    virtual void* Map() override;
+    virtual void Unmap(uint32_t size) override;
+    virtual uint32_t GetMappedOffset() const override
+    {
+        return m_MappedBase ? m_Region * m_Size : 0;
+    }
+
+    virtual uint32_t GetSize() const override
+    {
+        return m_Size;
+    }
+    virtual BufferUsage GetUsage() const override
+    {
+        return m_Usage;
+    }
+
     virtual const BufferLayout& GetLayout() const override
     {
         return m_Layout;
@@ -24,19 +48,35 @@ public:
     }
 
 private:
-    uint32_t m_RendererID;
+    uint32_t m_RendererID = 0;
+    uint32_t m_Size = 0;
+    BufferUsage m_Usage = BufferUsage::Static;
     BufferLayout m_Layout;
+
+    // NOTE: Persistent stream mode. The storage holds RingRegionCount regions of m_Size bytes; each region
+    // gets a fence once the GPU has been handed its contents and is only rewritten after that fence signals.
+    uint8_t* m_MappedBase = nullptr;
+    void* m_RegionFences[RingRegionCount] = {}; // NOTE: GLsync
+    uint32_t m_Region = 0;
+    bool m_RegionUsed = false;
+    bool m_Mapped = false;
+
+    // NOTE: Stream fallback (threaded rendering, or no GL 4.4): Map hands out this copy, Unmap orphans and uploads
+    std::vector<uint8_t> m_Staging;
 };
 
 class OpenGLIndexBuffer : public IndexBuffer
 {
 public:
+    OpenGLIndexBuffer(uint32_t count, BufferUsage usage);
     OpenGLIndexBuffer(uint32_t* indices, uint32_t count);
     virtual ~OpenGLIndexBuffer() override;
 
     virtual void Bind() const override;
     virtual void Unbind() const override;
 
+    virtual void SetData(const uint32_t* indices, uint32_t count, uint32_t offset = 0) override;
+
     virtual uint32_t GetCount() const override
     {
         return m_Count;
@@ -45,5 +85,6 @@ public:
 private:
     uint32_t m_RendererID;
     uint32_t m_Count;
+    BufferUsage m_Usage = BufferUsage::Static;
 };
-} // namespace Hazel
\ No newline at end of file
+} // namespace Hazel
@@ -27,4 +27,14 @@ void OpenGLContext::SwapBuffers()
 {
     glfwSwapBuffers(m_WindowHandle);
 }
+
+void OpenGLContext::MakeCurrent()
+{
+    glfwMakeContextCurrent(m_WindowHandle);
+}
+
+void OpenGLContext::ReleaseCurrent()
+{
+    glfwMakeContextCurrent(nullptr);
+}
 } // namespace Hazel
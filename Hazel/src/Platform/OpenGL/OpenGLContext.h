@@ -13,6 +13,9 @@ public:
     virtual void Init() override;
     virtual void SwapBuffers() override;
 
+    virtual void MakeCurrent() override;
+    virtual void ReleaseCurrent() override;
+
 private:
     GLFWwindow* m_WindowHandle;
 };
@@ -0,0 +1,62 @@
+#include "hzpch.h"
+#include "OpenGLGPUTimerQueries.h"
+
+#include <glad/glad.h>
+
+#include <algorithm>
+
+namespace Hazel
+{
+
+static constexpr uint32_t s_InitialQueryCount = 32;
+
+OpenGLGPUTimerQueries::OpenGLGPUTimerQueries(uint32_t frameCount) : m_Queries(frameCount)
+{
+}
+
+OpenGLGPUTimerQueries::~OpenGLGPUTimerQueries()
+{
+    for (auto& queries : m_Queries)
+    {
+        if (!queries.empty())
+            glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data());
+    }
+}
+
+void OpenGLGPUTimerQueries::WriteTimestamp(uint32_t frame, uint32_t index)
+{
+    std::vector<uint32_t>& queries = m_Queries[frame];
+    if (index >= queries.size())
+    {
+        const size_t oldSize = queries.size();
+        const size_t newSize = std::max<size_t>({index + 1, oldSize * 2, s_InitialQueryCount});
+        queries.resize(newSize);
+        glGenQueries(static_cast<GLsizei>(newSize - oldSize), queries.data() + oldSize);
+    }
+
+    glQueryCounter(queries[index], GL_TIMESTAMP);
+}
+
+bool OpenGLGPUTimerQueries::ReadTimestamps(uint32_t frame, uint32_t count, uint64_t* nanoseconds)
+{
+    const std::vector<uint32_t>& queries = m_Queries[frame];
+    if (count == 0 || count > queries.size())
+        return false;
+
+    // NOTE: Queries complete in submission order, so the last one being ready means all of them are
+    GLint available = 0;
+    glGetQueryObjectiv(queries[count - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+        return false;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        GLuint64 result = 0;
+        glGetQueryObjectui64v(queries[i], GL_QUERY_RESULT, &result);
+        nanoseconds[i] = result;
+    }
+
+    return true;
+}
+
+} // namespace Hazel
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Hazel/Renderer/GPUTimerQueries.h"
+
+#include <vector>
+
+namespace Hazel
+{
+
+// NOTE: GL_TIMESTAMP queries rather than GL_TIME_ELAPSED, which cannot nest. Pools grow on demand.
+class OpenGLGPUTimerQueries : public GPUTimerQueries
+{
+public:
+    OpenGLGPUTimerQueries(uint32_t frameCount);
+    virtual ~OpenGLGPUTimerQueries() override;
+
+    virtual void WriteTimestamp(uint32_t frame, uint32_t index) override;
+    virtual bool ReadTimestamps(uint32_t frame, uint32_t count, uint64_t* nanoseconds) override;
+
+private:
+    std::vector<std::vector<uint32_t>> m_Queries;
+};
+
+} // namespace Hazel
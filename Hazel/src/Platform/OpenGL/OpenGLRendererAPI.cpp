@@ -1,6 +1,9 @@
 #include "hzpch.h"
 #include "OpenGLRendererAPI.h"
 
+#include "Hazel/Renderer/RenderThread.h"
+#include "OpenGLStateCache.h"
+
 #include <glad/glad.h>
 #include <glm/vec4.hpp>
 
@@ -8,28 +11,66 @@ namespace Hazel
 {
 void OpenGLRendererAPI::Init()
 {
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    RenderThread::Submit([]() {
+        OpenGLStateCache::SetBlend(true);
+        OpenGLStateCache::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    });
 }
 
 void OpenGLRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
-    glViewport(x, y, width, height);
+    RenderThread::Submit([x, y, width, height]() { OpenGLStateCache::SetViewport(x, y, width, height); });
 }
 
 void OpenGLRendererAPI::SetClearColor(const glm::vec4& color)
 {
-    glClearColor(color.r, color.g, color.b, color.a);
+    RenderThread::Submit([color]() { glClearColor(color.r, color.g, color.b, color.a); });
 }
 
 void OpenGLRendererAPI::Clear()
 {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    RenderThread::Submit([]() { glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); });
+}
+
+void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
+{
+    vertexArray->Bind();
+    uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+    DrawIndexed(count);
+}
+
+void OpenGLRendererAPI::DrawIndexed(uint32_t indexCount)
+{
+    RenderThread::Submit([indexCount]() { glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr); });
 }
 
-void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray)
+void OpenGLRendererAPI::DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount,
+                                              uint32_t baseVertex)
+{
+    if (baseVertex == 0)
+    {
+        DrawIndexed(vertexArray, indexCount);
+        return;
+    }
+
+    vertexArray->Bind();
+    RenderThread::Submit([indexCount, baseVertex]() {
+        glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, static_cast<GLint>(baseVertex));
+    });
+}
+
+void OpenGLRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount,
+                                             uint32_t indexCount)
 {
     vertexArray->Bind();
-    glDrawElements(GL_TRIANGLES, vertexArray->GetIndexBuffer()->GetCount(), GL_UNSIGNED_INT, nullptr);
+    uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+    DrawIndexedInstanced(count, instanceCount);
+}
+
+void OpenGLRendererAPI::DrawIndexedInstanced(uint32_t indexCount, uint32_t instanceCount)
+{
+    RenderThread::Submit([indexCount, instanceCount]() {
+        glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, instanceCount);
+    });
 }
 } // namespace Hazel
@@ -18,7 +18,14 @@ public:
     virtual void SetClearColor(const glm::vec4& color) override;
     virtual void Clear() override;
 
-    virtual void DrawIndexed(const Ref<VertexArray>& vertexArray) override;
+    virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+    virtual void DrawIndexed(uint32_t indexCount) override;
+    virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount,
+                                       uint32_t baseVertex) override;
+
+    virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount,
+                                      uint32_t indexCount = 0) override;
+    virtual void DrawIndexedInstanced(uint32_t indexCount, uint32_t instanceCount) override;
 };
 
 } // namespace Hazel
@@ -2,7 +2,12 @@
 #include "OpenGLShader.h"
 
 #include "Hazel/Core/FileSystem.h"
+#include "Hazel/Renderer/RenderStatistics.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "Hazel/Renderer/UniformBuffer.h"
+#include "OpenGLStateCache.h"
 
+#include <cstring>
 #include <fstream>
 #include <glad/glad.h>
 
@@ -24,33 +29,40 @@ static GLenum ShaderTypeFromString(const std::string& type)
 
 OpenGLShader::OpenGLShader(const std::string& filepath)
 {
-    std::string source = ReadFile(filepath);
-    auto shaderSources = PreProcess(source);
-    Compile(shaderSources);
+    HZ_PROFILE_FUNCTION();
 
     // Extract name from filepath
     size_t lastSlash = filepath.find_last_of("/\\");
     lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
     size_t lastDot = filepath.rfind('.');
     m_Name = filepath.substr(lastSlash, lastDot - lastSlash);
+
+    std::string source = ReadFile(filepath);
+    auto shaderSources = PreProcess(source);
+    RenderThread::SubmitAndWait([this, &shaderSources]() { Compile(shaderSources); });
 }
 
 OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource)
     : m_Name(name)
 {
+    HZ_PROFILE_FUNCTION();
+
     std::unordered_map<GLenum, std::string> shaderSources;
     shaderSources[GL_VERTEX_SHADER] = vertexSource;
     shaderSources[GL_FRAGMENT_SHADER] = fragmentSource;
-    Compile(shaderSources);
+    RenderThread::SubmitAndWait([this, &shaderSources]() { Compile(shaderSources); });
 }
 
 OpenGLShader::~OpenGLShader()
 {
     glDeleteProgram(m_RendererID);
+    OpenGLStateCache::OnProgramDeleted(m_RendererID);
 }
 
 std::string OpenGLShader::ReadFile(const std::string& filepath)
 {
+    HZ_PROFILE_FUNCTION();
+
     std::string result;
     const auto resolvedPath = FileSystem::ResolvePath(filepath);
     std::ifstream in(resolvedPath, std::ios::in | std::ios::binary);
@@ -75,6 +87,8 @@ std::string OpenGLShader::ReadFile(const std::string& filepath)
 
 std::unordered_map<GLenum, std::string> OpenGLShader::PreProcess(const std::string& source)
 {
+    HZ_PROFILE_FUNCTION();
+
     std::unordered_map<GLenum, std::string> shaderSources;
 
     const char* typeToken = "#type";
@@ -99,6 +113,8 @@ std::unordered_map<GLenum, std::string> OpenGLShader::PreProcess(const std::stri
 
 void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources)
 {
+    HZ_PROFILE_FUNCTION();
+
     GLuint program = glCreateProgram();
     HZ_CORE_ASSERT(shaderSources.size() <= 2, "We only support 2 shaders for now (Vertex and Fragment)");
     std::array<GLenum, 2> glShaderIDs;
@@ -175,58 +191,267 @@ void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shader
     }
 
     m_RendererID = program;
+    Reflect();
 }
 
 void OpenGLShader::Bind() const
 {
-    glUseProgram(m_RendererID);
+    RenderCounters::Add(RenderCounters::Counter::ShaderBinds);
+    RenderThread::Submit([this]() { OpenGLStateCache::UseProgram(m_RendererID); });
 }
 
 void OpenGLShader::Unbind() const
 {
-    glUseProgram(0);
+    RenderThread::Submit([]() { OpenGLStateCache::UseProgram(0); });
+}
+
+static uint32_t UniformTypeSize(GLenum type)
+{
+    switch (type)
+    {
+    case GL_FLOAT:
+        return 4;
+    case GL_FLOAT_VEC2:
+        return 4 * 2;
+    case GL_FLOAT_VEC3:
+        return 4 * 3;
+    case GL_FLOAT_VEC4:
+        return 4 * 4;
+    case GL_FLOAT_MAT3:
+        return 4 * 3 * 3;
+    case GL_FLOAT_MAT4:
+        return 4 * 4 * 4;
+    case GL_INT_VEC2:
+    case GL_BOOL_VEC2:
+        return 4 * 2;
+    case GL_INT_VEC3:
+    case GL_BOOL_VEC3:
+        return 4 * 3;
+    case GL_INT_VEC4:
+    case GL_BOOL_VEC4:
+        return 4 * 4;
+    }
+
+    // NOTE: GL_INT, GL_BOOL and every sampler type are uploaded as a single int
+    return 4;
+}
+
+static bool SupportsProgramUniforms()
+{
+    return GLAD_GL_VERSION_4_1 && glProgramUniform1iv && glProgramUniformMatrix4fv;
+}
+
+void OpenGLShader::Reflect()
+{
+    HZ_PROFILE_FUNCTION();
+
+    m_Uniforms.clear();
+    m_UniformShadow.clear();
+
+    GLint uniformCount = 0;
+    GLint maxNameLength = 0;
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &uniformCount);
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+    std::vector<GLchar> nameBuffer(std::max(maxNameLength, 1));
+    uint32_t shadowSize = 0;
+    for (GLint i = 0; i < uniformCount; i++)
+    {
+        GLsizei nameLength = 0;
+        GLint arraySize = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_RendererID, static_cast<GLuint>(i), static_cast<GLsizei>(nameBuffer.size()), &nameLength,
+                           &arraySize, &type, nameBuffer.data());
+
+        // NOTE: Uniform block members report no location and are not set through this table
+        GLint location = glGetUniformLocation(m_RendererID, nameBuffer.data());
+        if (location < 0)
+            continue;
+
+        std::string_view name(nameBuffer.data(), static_cast<size_t>(nameLength));
+        size_t arraySuffix = name.find('[');
+        if (arraySuffix != std::string_view::npos)
+            name = name.substr(0, arraySuffix);
+
+        UniformSlot slot;
+        slot.Hash = ShaderUniform::HashName(name);
+        slot.Location = location;
+        slot.Type = type;
+        slot.Count = static_cast<uint32_t>(arraySize);
+        slot.ShadowOffset = shadowSize;
+        slot.ShadowSize = UniformTypeSize(type) * slot.Count;
+        slot.Uploaded = false;
+        m_Uniforms.push_back(slot);
+
+        shadowSize += slot.ShadowSize;
+    }
+
+    std::sort(m_Uniforms.begin(), m_Uniforms.end(),
+              [](const UniformSlot& a, const UniformSlot& b) { return a.Hash < b.Hash; });
+    m_UniformShadow.resize(shadowSize);
+
+    for (size_t i = 1; i < m_Uniforms.size(); i++)
+        HZ_CORE_ASSERT(m_Uniforms[i - 1].Hash != m_Uniforms[i].Hash, "Uniform name hash collision!");
+
+    // NOTE: Attach known uniform blocks to their shared binding points
+    for (const UniformBufferBinding& binding : s_UniformBufferBindings)
+    {
+        GLuint blockIndex = glGetUniformBlockIndex(m_RendererID, binding.BlockName);
+        if (blockIndex != GL_INVALID_INDEX)
+            glUniformBlockBinding(m_RendererID, blockIndex, binding.Binding);
+    }
+
+    HZ_CORE_TRACE("Shader '{0}': {1} active uniforms ({2} bytes shadowed)", m_Name, m_Uniforms.size(), shadowSize);
+}
+
+OpenGLShader::UniformSlot* OpenGLShader::FindUniform(ShaderUniform uniform)
+{
+    auto it = std::lower_bound(m_Uniforms.begin(), m_Uniforms.end(), uniform.Hash,
+                               [](const UniformSlot& slot, uint32_t hash) { return slot.Hash < hash; });
+    if (it == m_Uniforms.end() || it->Hash != uniform.Hash)
+        return nullptr;
+
+    return &*it;
+}
+
+const OpenGLShader::UniformSlot* OpenGLShader::FindUniform(ShaderUniform uniform) const
+{
+    return const_cast<OpenGLShader*>(this)->FindUniform(uniform);
 }
 
-void OpenGLShader::UploadUniformInt(const std::string& name, int value)
+bool OpenGLShader::UpdateShadow(UniformSlot& slot, const void* data, uint32_t size)
 {
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    glUniform1i(location, value);
+    size = std::min(size, slot.ShadowSize);
+    uint8_t* shadow = m_UniformShadow.data() + slot.ShadowOffset;
+    if (slot.Uploaded && std::memcmp(shadow, data, size) == 0)
+        return false;
+
+    std::memcpy(shadow, data, size);
+    slot.Uploaded = true;
+    return true;
 }
 
-void OpenGLShader::UploadUniformFloat(const std::string& name, float value)
+bool OpenGLShader::HasUniform(ShaderUniform uniform) const
 {
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    glUniform1f(location, value);
+    return FindUniform(uniform) != nullptr;
 }
 
-void OpenGLShader::UploadUniformFloat2(const std::string& name, const glm::vec2& values)
+// NOTE: Lookup and shadow comparison run on the submitting thread; only the upload itself is queued
+void OpenGLShader::SetInt(ShaderUniform uniform, int value)
 {
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    glUniform2f(location, values.x, values.y);
+    UniformSlot* slot = FindUniform(uniform);
+    if (!slot || !UpdateShadow(*slot, &value, sizeof(int)))
+        return;
+
+    RenderThread::Submit([this, location = slot->Location, value]() {
+        if (SupportsProgramUniforms())
+            glProgramUniform1i(m_RendererID, location, value);
+        else
+            glUniform1i(location, value);
+    });
 }
 
-void OpenGLShader::UploadUniformFloat3(const std::string& name, const glm::vec3& values)
+void OpenGLShader::SetIntArray(ShaderUniform uniform, const int* values, uint32_t count)
 {
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    glUniform3f(location, values.x, values.y, values.z);
+    UniformSlot* slot = FindUniform(uniform);
+    if (!slot)
+        return;
+
+    count = std::min(count, slot->Count);
+    if (!UpdateShadow(*slot, values, count * sizeof(int)))
+        return;
+
+    const int* frameValues = static_cast<const int*>(RenderThread::CopyFrameData(values, count * sizeof(int)));
+    RenderThread::Submit([this, location = slot->Location, frameValues, count]() {
+        if (SupportsProgramUniforms())
+            glProgramUniform1iv(m_RendererID, location, static_cast<GLsizei>(count), frameValues);
+        else
+            glUniform1iv(location, static_cast<GLsizei>(count), frameValues);
+    });
 }
 
-void OpenGLShader::UploadUniformFloat4(const std::string& name, const glm::vec4& values)
+void OpenGLShader::SetFloat(ShaderUniform uniform, float value)
 {
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    glUniform4f(location, values.x, values.y, values.z, values.w);
+    UniformSlot* slot = FindUniform(uniform);
+    if (!slot || !UpdateShadow(*slot, &value, sizeof(float)))
+        return;
+
+    RenderThread::Submit([this, location = slot->Location, value]() {
+        if (SupportsProgramUniforms())
+            glProgramUniform1f(m_RendererID, location, value);
+        else
+            glUniform1f(location, value);
+    });
 }
 
-void OpenGLShader::UploadUniformMat3(const std::string& name, const glm::mat3& matrix)
+void OpenGLShader::SetFloat2(ShaderUniform uniform, const glm::vec2& value)
 {
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+    UniformSlot* slot = FindUniform(uniform);
+    if (!slot || !UpdateShadow(*slot, glm::value_ptr(value), sizeof(glm::vec2)))
+        return;
+
+    RenderThread::Submit([this, location = slot->Location, value]() {
+        if (SupportsProgramUniforms())
+            glProgramUniform2f(m_RendererID, location, value.x, value.y);
+        else
+            glUniform2f(location, value.x, value.y);
+    });
 }
 
-void OpenGLShader::UploadUniformMat4(const std::string& name, const glm::mat4& matrix)
+void OpenGLShader::SetFloat3(ShaderUniform uniform, const glm::vec3& value)
 {
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+    UniformSlot* slot = FindUniform(uniform);
+    if (!slot || !UpdateShadow(*slot, glm::value_ptr(value), sizeof(glm::vec3)))
+        return;
+
+    RenderThread::Submit([this, location = slot->Location, value]() {
+        if (SupportsProgramUniforms())
+            glProgramUniform3f(m_RendererID, location, value.x, value.y, value.z);
+        else
+            glUniform3f(location, value.x, value.y, value.z);
+    });
+}
+
+void OpenGLShader::SetFloat4(ShaderUniform uniform, const glm::vec4& value)
+{
+    UniformSlot* slot = FindUniform(uniform);
+    if (!slot || !UpdateShadow(*slot, glm::value_ptr(value), sizeof(glm::vec4)))
+        return;
+
+    RenderThread::Submit([this, location = slot->Location, value]() {
+        if (SupportsProgramUniforms())
+            glProgramUniform4f(m_RendererID, location, value.x, value.y, value.z, value.w);
+        else
+            glUniform4f(location, value.x, value.y, value.z, value.w);
+    });
+}
+
+void OpenGLShader::SetMat3(ShaderUniform uniform, const glm::mat3& value)
+{
+    UniformSlot* slot = FindUniform(uniform);
+    if (!slot || !UpdateShadow(*slot, glm::value_ptr(value), sizeof(glm::mat3)))
+        return;
+
+    RenderThread::Submit([this, location = slot->Location, value]() {
+        if (SupportsProgramUniforms())
+            glProgramUniformMatrix3fv(m_RendererID, location, 1, GL_FALSE, glm::value_ptr(value));
+        else
+            glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value));
+    });
+}
+
+void OpenGLShader::SetMat4(ShaderUniform uniform, const glm::mat4& value)
+{
+    UniformSlot* slot = FindUniform(uniform);
+    if (!slot || !UpdateShadow(*slot, glm::value_ptr(value), sizeof(glm::mat4)))
+        return;
+
+    RenderThread::Submit([this, location = slot->Location, value]() {
+        if (SupportsProgramUniforms())
+            glProgramUniformMatrix4fv(m_RendererID, location, 1, GL_FALSE, glm::value_ptr(value));
+        else
+            glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+    });
 }
 
 } // namespace Hazel
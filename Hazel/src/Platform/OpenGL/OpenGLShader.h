@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <cstdint>
 #include <string>
+#include <vector>
 #include <glm/glm.hpp>
 
 // TODO: Remove this once glad is included in the precompiled header
@@ -27,24 +28,51 @@ public:
     {
         return m_Name;
     }
+    virtual uint32_t GetRendererID() const override
+    {
+        return m_RendererID;
+    }
 
-    void UploadUniformInt(const std::string& name, int value);
+    virtual bool HasUniform(ShaderUniform uniform) const override;
 
-    void UploadUniformFloat(const std::string& name, float value);
-    void UploadUniformFloat2(const std::string& name, const glm::vec2& values);
-    void UploadUniformFloat3(const std::string& name, const glm::vec3& values);
-    void UploadUniformFloat4(const std::string& name, const glm::vec4& values);
+    virtual void SetInt(ShaderUniform uniform, int value) override;
+    virtual void SetIntArray(ShaderUniform uniform, const int* values, uint32_t count) override;
+    virtual void SetFloat(ShaderUniform uniform, float value) override;
+    virtual void SetFloat2(ShaderUniform uniform, const glm::vec2& value) override;
+    virtual void SetFloat3(ShaderUniform uniform, const glm::vec3& value) override;
+    virtual void SetFloat4(ShaderUniform uniform, const glm::vec4& value) override;
+    virtual void SetMat3(ShaderUniform uniform, const glm::mat3& value) override;
+    virtual void SetMat4(ShaderUniform uniform, const glm::mat4& value) override;
 
-    void UploadUniformMat3(const std::string& name, const glm::mat3& matrix);
-    void UploadUniformMat4(const std::string& name, const glm::mat4& matrix);
+    // NOTE: Splits a combined source at its "#type" lines. Needs no context, so tools and benchmarks can call it.
+    static std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
 
 private:
     std::string ReadFile(const std::string& filepath);
-    std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
     void Compile(const std::unordered_map<GLenum, std::string>& shaderSources);
+    void Reflect();
+
+    struct UniformSlot
+    {
+        uint32_t Hash;
+        int32_t Location;
+        GLenum Type;
+        uint32_t Count;
+        uint32_t ShadowOffset;
+        uint32_t ShadowSize;
+        bool Uploaded;
+    };
+
+    UniformSlot* FindUniform(ShaderUniform uniform);
+    const UniformSlot* FindUniform(ShaderUniform uniform) const;
+    bool UpdateShadow(UniformSlot& slot, const void* data, uint32_t size);
 
 private:
     uint32_t m_RendererID;
     std::string m_Name;
+
+    // NOTE: Sorted by hash; filled once after link
+    std::vector<UniformSlot> m_Uniforms;
+    std::vector<uint8_t> m_UniformShadow;
 };
 } // namespace Hazel
\ No newline at end of file
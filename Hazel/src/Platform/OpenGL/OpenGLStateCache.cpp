@@ -0,0 +1,263 @@
+#include "hzpch.h"
+#include "OpenGLStateCache.h"
+
+#include <glad/glad.h>
+
+#include <atomic>
+
+namespace Hazel
+{
+
+namespace
+{
+constexpr uint32_t Unknown = 0xFFFFFFFF;
+
+enum class TriState : int8_t
+{
+    Unknown = -1,
+    Off = 0,
+    On = 1
+};
+
+struct StateCacheData
+{
+    uint32_t Program = Unknown;
+    uint32_t VertexArray = Unknown;
+    uint32_t ArrayBuffer = Unknown;
+    // NOTE: Element buffer binding is vertex array state; it is forgotten whenever the vertex array changes
+    uint32_t ElementArrayBuffer = Unknown;
+    uint32_t UniformBuffer = Unknown;
+
+    uint32_t ActiveTextureUnit = Unknown;
+    uint32_t TextureUnits[OpenGLStateCache::MaxTextureUnits];
+
+    TriState Blend = TriState::Unknown;
+    GLenum BlendSource = Unknown;
+    GLenum BlendDestination = Unknown;
+    TriState DepthTest = TriState::Unknown;
+
+    uint32_t Viewport[4] = {Unknown, Unknown, Unknown, Unknown};
+
+    // NOTE: Single writer (the context thread); relaxed atomics only so other threads can read them
+    std::atomic<uint32_t> Issued{0};
+    std::atomic<uint32_t> Skipped{0};
+
+    StateCacheData()
+    {
+        for (uint32_t& unit : TextureUnits)
+            unit = Unknown;
+    }
+};
+} // namespace
+
+static StateCacheData s_State;
+
+static void Count(std::atomic<uint32_t>& counter)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+// NOTE: Returns true when the call has to be issued, and records the new value
+template <typename T> static bool Update(T& cached, T value)
+{
+    if (cached == value)
+    {
+        Count(s_State.Skipped);
+        return false;
+    }
+
+    cached = value;
+    Count(s_State.Issued);
+    return true;
+}
+
+static bool SupportsBindTextureUnit()
+{
+    return GLAD_GL_VERSION_4_5 && glBindTextureUnit;
+}
+
+void OpenGLStateCache::UseProgram(uint32_t program)
+{
+    if (Update(s_State.Program, program))
+        glUseProgram(program);
+}
+
+void OpenGLStateCache::BindVertexArray(uint32_t vertexArray)
+{
+    if (Update(s_State.VertexArray, vertexArray))
+    {
+        glBindVertexArray(vertexArray);
+        s_State.ElementArrayBuffer = Unknown;
+    }
+}
+
+void OpenGLStateCache::BindBuffer(GLenum target, uint32_t buffer)
+{
+    uint32_t* cached = nullptr;
+    switch (target)
+    {
+    case GL_ARRAY_BUFFER:
+        cached = &s_State.ArrayBuffer;
+        break;
+    case GL_ELEMENT_ARRAY_BUFFER:
+        cached = &s_State.ElementArrayBuffer;
+        break;
+    case GL_UNIFORM_BUFFER:
+        cached = &s_State.UniformBuffer;
+        break;
+    }
+
+    if (!cached)
+    {
+        Count(s_State.Issued);
+        glBindBuffer(target, buffer);
+        return;
+    }
+
+    if (Update(*cached, buffer))
+        glBindBuffer(target, buffer);
+}
+
+void OpenGLStateCache::BindTexture(uint32_t slot, uint32_t texture)
+{
+    HZ_CORE_ASSERT(slot < MaxTextureUnits, "Texture slot out of range!");
+
+    if (!Update(s_State.TextureUnits[slot], texture))
+        return;
+
+    if (SupportsBindTextureUnit())
+    {
+        glBindTextureUnit(slot, texture);
+        return;
+    }
+
+    if (s_State.ActiveTextureUnit != slot)
+    {
+        s_State.ActiveTextureUnit = slot;
+        glActiveTexture(GL_TEXTURE0 + slot);
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+void OpenGLStateCache::SetBlend(bool enabled)
+{
+    if (!Update(s_State.Blend, enabled ? TriState::On : TriState::Off))
+        return;
+
+    if (enabled)
+        glEnable(GL_BLEND);
+    else
+        glDisable(GL_BLEND);
+}
+
+void OpenGLStateCache::SetBlendFunc(GLenum source, GLenum destination)
+{
+    if (s_State.BlendSource == source && s_State.BlendDestination == destination)
+    {
+        Count(s_State.Skipped);
+        return;
+    }
+
+    s_State.BlendSource = source;
+    s_State.BlendDestination = destination;
+    Count(s_State.Issued);
+    glBlendFunc(source, destination);
+}
+
+void OpenGLStateCache::SetDepthTest(bool enabled)
+{
+    if (!Update(s_State.DepthTest, enabled ? TriState::On : TriState::Off))
+        return;
+
+    if (enabled)
+        glEnable(GL_DEPTH_TEST);
+    else
+        glDisable(GL_DEPTH_TEST);
+}
+
+void OpenGLStateCache::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    uint32_t* viewport = s_State.Viewport;
+    if (viewport[0] == x && viewport[1] == y && viewport[2] == width && viewport[3] == height)
+    {
+        Count(s_State.Skipped);
+        return;
+    }
+
+    viewport[0] = x;
+    viewport[1] = y;
+    viewport[2] = width;
+    viewport[3] = height;
+    Count(s_State.Issued);
+    glViewport(x, y, width, height);
+}
+
+void OpenGLStateCache::OnProgramDeleted(uint32_t program)
+{
+    if (s_State.Program == program)
+        s_State.Program = Unknown;
+}
+
+void OpenGLStateCache::OnVertexArrayDeleted(uint32_t vertexArray)
+{
+    if (s_State.VertexArray == vertexArray)
+    {
+        s_State.VertexArray = Unknown;
+        s_State.ElementArrayBuffer = Unknown;
+    }
+}
+
+void OpenGLStateCache::OnBufferDeleted(uint32_t buffer)
+{
+    for (uint32_t* cached : {&s_State.ArrayBuffer, &s_State.ElementArrayBuffer, &s_State.UniformBuffer})
+    {
+        if (*cached == buffer)
+            *cached = Unknown;
+    }
+}
+
+void OpenGLStateCache::OnTextureDeleted(uint32_t texture)
+{
+    for (uint32_t& unit : s_State.TextureUnits)
+    {
+        if (unit == texture)
+            unit = Unknown;
+    }
+}
+
+void OpenGLStateCache::Invalidate()
+{
+    s_State.Program = Unknown;
+    s_State.VertexArray = Unknown;
+    s_State.ArrayBuffer = Unknown;
+    s_State.ElementArrayBuffer = Unknown;
+    s_State.UniformBuffer = Unknown;
+
+    s_State.ActiveTextureUnit = Unknown;
+    for (uint32_t& unit : s_State.TextureUnits)
+        unit = Unknown;
+
+    s_State.Blend = TriState::Unknown;
+    s_State.BlendSource = Unknown;
+    s_State.BlendDestination = Unknown;
+    s_State.DepthTest = TriState::Unknown;
+
+    for (uint32_t& value : s_State.Viewport)
+        value = Unknown;
+}
+
+OpenGLStateCache::Statistics OpenGLStateCache::GetStatistics()
+{
+    Statistics stats;
+    stats.Issued = s_State.Issued.load(std::memory_order_relaxed);
+    stats.Skipped = s_State.Skipped.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void OpenGLStateCache::ResetStatistics()
+{
+    s_State.Issued.store(0, std::memory_order_relaxed);
+    s_State.Skipped.store(0, std::memory_order_relaxed);
+}
+
+} // namespace Hazel
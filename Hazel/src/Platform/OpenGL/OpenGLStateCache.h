@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+// TODO: Remove this once glad is included in the precompiled header
+typedef unsigned int GLenum;
+
+namespace Hazel
+{
+
+// NOTE: Shadow of the GL state the renderer touches. Every setter compares against the last value it issued
+// and drops the call when nothing would change. Only the thread that owns the context may call into it.
+//
+// Anything that changes GL state without going through the cache (e.g. the ImGui backend) must be followed
+// by Invalidate(), after which the next call of each kind is issued unconditionally.
+class OpenGLStateCache
+{
+public:
+    static constexpr uint32_t MaxTextureUnits = 32;
+
+    struct Statistics
+    {
+        uint32_t Issued = 0;
+        uint32_t Skipped = 0;
+    };
+
+    static void UseProgram(uint32_t program);
+    static void BindVertexArray(uint32_t vertexArray);
+    // NOTE: GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER and GL_UNIFORM_BUFFER are cached; other targets pass through
+    static void BindBuffer(GLenum target, uint32_t buffer);
+    static void BindTexture(uint32_t slot, uint32_t texture);
+
+    static void SetBlend(bool enabled);
+    static void SetBlendFunc(GLenum source, GLenum destination);
+    static void SetDepthTest(bool enabled);
+    static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+    // NOTE: Deleting a bound object implicitly rebinds 0, so the cache must forget it too
+    static void OnProgramDeleted(uint32_t program);
+    static void OnVertexArrayDeleted(uint32_t vertexArray);
+    static void OnBufferDeleted(uint32_t buffer);
+    static void OnTextureDeleted(uint32_t texture);
+
+    static void Invalidate();
+
+    static Statistics GetStatistics();
+    static void ResetStatistics();
+};
+
+} // namespace Hazel
@@ -2,6 +2,9 @@
 #include "OpenGLTexture.h"
 
 #include "Hazel/Core/FileSystem.h"
+#include "Hazel/Renderer/RenderStatistics.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "OpenGLStateCache.h"
 
 #include "stb_image.h"
 
@@ -35,13 +38,16 @@ static void UploadTexture2D(GLuint rendererID, GLenum internalFormat, GLenum dat
         glTextureParameteri(rendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTextureParameteri(rendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-        glTextureSubImage2D(rendererID, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, data);
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        if (data)
+        {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTextureSubImage2D(rendererID, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, data);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        }
         return;
     }
 
-    glBindTexture(GL_TEXTURE_2D, rendererID);
+    OpenGLStateCache::BindTexture(0, rendererID);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
@@ -49,12 +55,39 @@ static void UploadTexture2D(GLuint rendererID, GLenum internalFormat, GLenum dat
     glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, static_cast<GLsizei>(width), static_cast<GLsizei>(height), 0,
                  dataFormat, GL_UNSIGNED_BYTE, data);
     glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+static void UpdateTexture2D(GLuint rendererID, GLenum dataFormat, uint32_t width, uint32_t height, const void* data)
+{
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    if (SupportsDirectStateAccessTextures())
+    {
+        glTextureSubImage2D(rendererID, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, data);
+    }
+    else
+    {
+        OpenGLStateCache::BindTexture(0, rendererID);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height), dataFormat,
+                        GL_UNSIGNED_BYTE, data);
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height)
+    : m_Width(width), m_Height(height), m_RendererID(0), m_InternalFormat(GL_RGBA8), m_DataFormat(GL_RGBA)
+{
+    HZ_PROFILE_FUNCTION();
+
+    RenderThread::SubmitAndWait([this]() {
+        CreateTexture(m_RendererID);
+        UploadTexture2D(m_RendererID, m_InternalFormat, m_DataFormat, m_Width, m_Height, nullptr);
+    });
 }
 
 OpenGLTexture2D::OpenGLTexture2D(const std::string& path) : m_Path(path), m_RendererID(0)
 {
+    HZ_PROFILE_FUNCTION();
+
     int width = 0;
     int height = 0;
     int channels = 0;
@@ -103,8 +136,16 @@ OpenGLTexture2D::OpenGLTexture2D(const std::string& path) : m_Path(path), m_Rend
         return;
     }
 
-    CreateTexture(m_RendererID);
-    UploadTexture2D(m_RendererID, internalFormat, dataFormat, m_Width, m_Height, data);
+    m_InternalFormat = internalFormat;
+    m_DataFormat = dataFormat;
+
+    RenderCounters::Add(RenderCounters::Counter::TextureBytesUploaded, static_cast<uint64_t>(width) * height * channels);
+
+    // NOTE: Decoding stays on the calling thread; only the upload needs the context
+    RenderThread::SubmitAndWait([this, data]() {
+        CreateTexture(m_RendererID);
+        UploadTexture2D(m_RendererID, m_InternalFormat, m_DataFormat, m_Width, m_Height, data);
+    });
 
     stbi_image_free(data);
 }
@@ -112,18 +153,27 @@ OpenGLTexture2D::OpenGLTexture2D(const std::string& path) : m_Path(path), m_Rend
 OpenGLTexture2D::~OpenGLTexture2D()
 {
     glDeleteTextures(1, &m_RendererID);
+    OpenGLStateCache::OnTextureDeleted(m_RendererID);
 }
 
-void OpenGLTexture2D::Bind(uint32_t slot) const
+void OpenGLTexture2D::SetData(void* data, uint32_t size)
 {
-    if (SupportsDirectStateAccessTextures())
-    {
-        glBindTextureUnit(slot, m_RendererID);
-        return;
-    }
+    HZ_PROFILE_FUNCTION();
 
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    // NOTE: Spelled out inside the assert so release builds, which compile it out, have no unused variable
+    HZ_CORE_ASSERT(size == m_Width * m_Height * (m_DataFormat == GL_RGBA ? 4 : m_DataFormat == GL_RGB ? 3 : 1),
+                   "Data must be entire texture!");
+
+    RenderCounters::Add(RenderCounters::Counter::TextureBytesUploaded, size);
+    const void* frameData = RenderThread::CopyFrameData(data, size);
+    RenderThread::Submit(
+        [this, frameData]() { UpdateTexture2D(m_RendererID, m_DataFormat, m_Width, m_Height, frameData); });
+}
+
+void OpenGLTexture2D::Bind(uint32_t slot) const
+{
+    RenderCounters::Add(RenderCounters::Counter::TextureBinds);
+    RenderThread::Submit([this, slot]() { OpenGLStateCache::BindTexture(slot, m_RendererID); });
 }
 
 } // namespace Hazel
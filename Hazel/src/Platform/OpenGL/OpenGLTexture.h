@@ -8,6 +8,7 @@ namespace Hazel
 class OpenGLTexture2D : public Texture2D
 {
 public:
+    OpenGLTexture2D(uint32_t width, uint32_t height);
     OpenGLTexture2D(const std::string& path);
     virtual ~OpenGLTexture2D() override;
 
@@ -19,6 +20,12 @@ public:
     {
         return m_Height;
     }
+    virtual uint32_t GetRendererID() const override
+    {
+        return m_RendererID;
+    }
+
+    virtual void SetData(void* data, uint32_t size) override;
 
     virtual void Bind(uint32_t slot = 0) const override;
 
@@ -27,6 +34,8 @@ private:
     uint32_t m_Width = 0;
     uint32_t m_Height = 0;
     uint32_t m_RendererID;
+    uint32_t m_InternalFormat = 0;
+    uint32_t m_DataFormat = 0;
 };
 
 } // namespace Hazel
\ No newline at end of file
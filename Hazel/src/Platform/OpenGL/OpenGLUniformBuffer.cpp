@@ -0,0 +1,64 @@
+#include "hzpch.h"
+#include "OpenGLUniformBuffer.h"
+
+#include "Hazel/Renderer/RenderStatistics.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "OpenGLStateCache.h"
+
+#include <glad/glad.h>
+
+namespace Hazel
+{
+
+static bool SupportsNamedBuffers()
+{
+    return GLAD_GL_VERSION_4_5 && glCreateBuffers && glNamedBufferData && glNamedBufferSubData;
+}
+
+OpenGLUniformBuffer::OpenGLUniformBuffer(uint32_t size, uint32_t binding) : m_Size(size), m_Binding(binding)
+{
+    RenderThread::SubmitAndWait([this]() {
+        if (SupportsNamedBuffers())
+        {
+            glCreateBuffers(1, &m_RendererID);
+            glNamedBufferData(m_RendererID, m_Size, nullptr, GL_DYNAMIC_DRAW);
+        }
+        else
+        {
+            glGenBuffers(1, &m_RendererID);
+            OpenGLStateCache::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+            glBufferData(GL_UNIFORM_BUFFER, m_Size, nullptr, GL_DYNAMIC_DRAW);
+        }
+
+        // NOTE: The indexed binding stays put for the buffer's lifetime; shaders find it by binding point.
+        // glBindBufferBase also moves the generic binding, so route that through the cache first.
+        OpenGLStateCache::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+        glBindBufferBase(GL_UNIFORM_BUFFER, m_Binding, m_RendererID);
+    });
+}
+
+OpenGLUniformBuffer::~OpenGLUniformBuffer()
+{
+    glDeleteBuffers(1, &m_RendererID);
+    OpenGLStateCache::OnBufferDeleted(m_RendererID);
+}
+
+void OpenGLUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+{
+    HZ_CORE_ASSERT(offset + size <= m_Size, "Uniform buffer write out of range!");
+
+    RenderCounters::Add(RenderCounters::Counter::BufferBytesUploaded, size);
+    const void* frameData = RenderThread::CopyFrameData(data, size);
+    RenderThread::Submit([this, frameData, size, offset]() {
+        if (SupportsNamedBuffers())
+        {
+            glNamedBufferSubData(m_RendererID, offset, size, frameData);
+            return;
+        }
+
+        OpenGLStateCache::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+        glBufferSubData(GL_UNIFORM_BUFFER, offset, size, frameData);
+    });
+}
+
+} // namespace Hazel
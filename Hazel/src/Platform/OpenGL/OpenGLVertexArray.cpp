@@ -2,6 +2,10 @@
 
 #include "OpenGLVertexArray.h"
 
+#include "Hazel/Renderer/RenderStatistics.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "OpenGLStateCache.h"
+
 #include <glad/glad.h>
 
 namespace Hazel
@@ -50,48 +54,72 @@ static GLenum ShaderDataTypeToOpenGLBaseType(ShaderDataType type)
 
 OpenGLVertexArray::OpenGLVertexArray()
 {
-    CreateVertexArray(m_RendererID);
+    RenderThread::SubmitAndWait([this]() { CreateVertexArray(m_RendererID); });
 }
 
 OpenGLVertexArray::~OpenGLVertexArray()
 {
     glDeleteVertexArrays(1, &m_RendererID);
+    OpenGLStateCache::OnVertexArrayDeleted(m_RendererID);
 }
 
 void OpenGLVertexArray::Bind() const
 {
-    glBindVertexArray(m_RendererID);
+    RenderCounters::Add(RenderCounters::Counter::VertexArrayBinds);
+    RenderThread::Submit([this]() { OpenGLStateCache::BindVertexArray(m_RendererID); });
 }
 
 void OpenGLVertexArray::Unbind() const
 {
-    glBindVertexArray(0);
+    RenderThread::Submit([]() { OpenGLStateCache::BindVertexArray(0); });
 }
 
 void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
 {
     HZ_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
 
-    glBindVertexArray(m_RendererID);
+    Bind();
     vertexBuffer->Bind();
 
-    uint32_t index = 0;
-    const auto& layout = vertexBuffer->GetLayout();
-    for (const auto& element : layout)
-    {
-        glEnableVertexAttribArray(index);
-        glVertexAttribPointer(index, element.GetComponentCount(), ShaderDataTypeToOpenGLBaseType(element.Type),
-                              element.Normalized ? GL_TRUE : GL_FALSE, layout.GetStride(),
-                              reinterpret_cast<const void*>(static_cast<uintptr_t>(element.Offset)));
-        index++;
-    }
+    // NOTE: Locations continue across buffers, so per-vertex and per-instance streams can share one array
+    const uint32_t firstIndex = m_VertexAttributeIndex;
+    for (const auto& element : vertexBuffer->GetLayout())
+        m_VertexAttributeIndex += element.GetLocationCount();
+
+    // NOTE: The layout is owned by the buffer, which the queued command keeps alive
+    RenderThread::Submit([vertexBuffer, firstIndex]() {
+        uint32_t index = firstIndex;
+        const auto& layout = vertexBuffer->GetLayout();
+        for (const auto& element : layout)
+        {
+            const GLenum baseType = ShaderDataTypeToOpenGLBaseType(element.Type);
+            const uint32_t locationCount = element.GetLocationCount();
+            const uint32_t componentCount = element.GetComponentCount() / locationCount;
+            const uint32_t columnSize = element.Size / locationCount;
+
+            for (uint32_t column = 0; column < locationCount; column++)
+            {
+                const void* offset =
+                    reinterpret_cast<const void*>(static_cast<uintptr_t>(element.Offset + column * columnSize));
+
+                glEnableVertexAttribArray(index);
+                if (element.IsInteger())
+                    glVertexAttribIPointer(index, componentCount, baseType, layout.GetStride(), offset);
+                else
+                    glVertexAttribPointer(index, componentCount, baseType, element.Normalized ? GL_TRUE : GL_FALSE,
+                                          layout.GetStride(), offset);
+                glVertexAttribDivisor(index, element.Divisor);
+                index++;
+            }
+        }
+    });
 
     m_VertexBuffers.push_back(vertexBuffer);
 }
 
 void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
 {
-    glBindVertexArray(m_RendererID);
+    Bind();
     indexBuffer->Bind();
 
     m_IndexBuffer = indexBuffer;
@@ -27,8 +27,14 @@ public:
         return m_IndexBuffer;
     }
 
+    virtual uint32_t GetRendererID() const override
+    {
+        return m_RendererID;
+    }
+
 private:
     uint32_t m_RendererID;
+    uint32_t m_VertexAttributeIndex = 0;
     std::vector<Ref<VertexBuffer>> m_VertexBuffers;
     Ref<IndexBuffer> m_IndexBuffer;
 };
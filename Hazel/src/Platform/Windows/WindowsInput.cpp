@@ -1,48 +0,0 @@
-#include "hzpch.h"
-#include "WindowsInput.h"
-
-#include "Hazel/Core/Application.h"
-#include <GLFW/glfw3.h>
-
-namespace Hazel
-{
-
-Input* Input::s_Instance = new WindowsInput();
-
-bool WindowsInput::IsKeyPressedImpl(int keycode)
-{
-    GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
-    int state = glfwGetKey(window, keycode);
-    return state == GLFW_PRESS || state == GLFW_REPEAT;
-}
-
-bool WindowsInput::IsMouseButtonPressedImpl(int button)
-{
-    GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
-    int state = glfwGetMouseButton(window, button);
-    return state == GLFW_PRESS;
-}
-
-float WindowsInput::GetMouseXImpl()
-{
-    // NOTE: C++ 17
-    auto [x, y] = GetMousePositionImpl();
-    return static_cast<float>(x);
-}
-
-float WindowsInput::GetMouseYImpl()
-{
-    GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
-    double xpos, ypos;
-    glfwGetCursorPos(window, &xpos, &ypos);
-    return static_cast<float>(ypos);
-}
-
-std::pair<float, float> WindowsInput::GetMousePositionImpl()
-{
-    GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
-    double xpos, ypos;
-    glfwGetCursorPos(window, &xpos, &ypos);
-    return {static_cast<float>(xpos), static_cast<float>(ypos)};
-}
-} // namespace Hazel
@@ -5,6 +5,9 @@
 #include "Hazel/Events/KeyEvent.h"
 #include "Hazel/Events/MouseEvent.h"
 
+#include "Hazel/Renderer/RenderThread.h"
+
+#include "Platform/Null/NullWindow.h"
 #include "Platform/OpenGL/OpenGLContext.h"
 
 #include <glad/glad.h>
@@ -21,6 +24,9 @@ static void GLFWErrorCallback(int error, const char* description)
 
 std::unique_ptr<Window> Window::Create(const WindowProps& props)
 {
+    if (props.Headless)
+        return std::make_unique<NullWindow>(props);
+
     return std::make_unique<WindowsWindow>(props);
 }
 
@@ -36,6 +42,8 @@ WindowsWindow::~WindowsWindow()
 
 void WindowsWindow::Init(const WindowProps& props)
 {
+    HZ_PROFILE_FUNCTION();
+
     m_Data.Title = props.Title;
     m_Data.Width = props.Width;
     m_Data.Height = props.Height;
@@ -86,6 +94,21 @@ void WindowsWindow::Init(const WindowProps& props)
         data.EventCallback(event);
     });
 
+    glfwSetWindowFocusCallback(m_Window, [](GLFWwindow* window, int focused) {
+        WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
+
+        if (focused)
+        {
+            WindowFocusEvent event;
+            data.EventCallback(event);
+        }
+        else
+        {
+            WindowLostFocusEvent event;
+            data.EventCallback(event);
+        }
+    });
+
     glfwSetKeyCallback(m_Window, [](GLFWwindow* window, int key, int scancode, int action, int mods) {
         WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
 
@@ -146,26 +169,56 @@ void WindowsWindow::Init(const WindowProps& props)
         MouseMovedEvent event(static_cast<float>(xPos), static_cast<float>(yPos));
         data.EventCallback(event);
     });
+
+    if (props.ThreadedRendering)
+    {
+        m_Context->ReleaseCurrent();
+        RenderThread::Start(m_Context.get());
+    }
 }
 
 void WindowsWindow::Shutdown()
 {
+    HZ_PROFILE_FUNCTION();
+
+    // NOTE: Resources released during application teardown queue their deletes, so the render thread has to
+    // drain before the context goes away. Anything released afterwards runs inline on this thread.
+    if (RenderThread::IsRunning())
+    {
+        RenderThread::Stop();
+        m_Context->MakeCurrent();
+    }
+
     m_Context.reset();
     glfwDestroyWindow(m_Window);
 }
 
 void WindowsWindow::OnUpdate()
 {
+    HZ_PROFILE_FUNCTION();
+
     glfwPollEvents();
-    m_Context->SwapBuffers();
+
+    GraphicsContext* context = m_Context.get();
+    RenderThread::Submit([context]() { context->SwapBuffers(); });
+    RenderThread::NextFrame();
+}
+
+void WindowsWindow::WaitEvents(double timeoutSeconds)
+{
+    HZ_PROFILE_FUNCTION();
+
+    glfwWaitEventsTimeout(timeoutSeconds);
+}
+
+void WindowsWindow::Wake()
+{
+    glfwPostEmptyEvent();
 }
 
 void WindowsWindow::SetVSync(bool enabled)
 {
-    if (enabled)
-        glfwSwapInterval(1);
-    else
-        glfwSwapInterval(0);
+    RenderThread::Submit([enabled]() { glfwSwapInterval(enabled ? 1 : 0); });
 
     m_Data.VSync = enabled;
 }
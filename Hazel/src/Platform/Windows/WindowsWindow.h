@@ -20,6 +20,8 @@ public:
     virtual ~WindowsWindow();
 
     void OnUpdate() override;
+    void WaitEvents(double timeoutSeconds) override;
+    void Wake() override;
 
     inline unsigned int GetWidth() const override
     {
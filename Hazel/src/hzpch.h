@@ -14,6 +14,8 @@
 #include <vector>
 
 #include "Hazel/Core/Log.h"
+#include "Hazel/Debug/AllocationTracker.h"
+#include "Hazel/Debug/Instrumentor.h"
 
 #ifdef HZ_PLATFORM_WINDOWS
 #include <Windows.h>
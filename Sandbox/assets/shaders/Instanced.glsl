@@ -0,0 +1,38 @@
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_TexCoord;
+layout(location = 2) in mat4 a_InstanceTransform;
+layout(location = 6) in vec4 a_InstanceColor;
+
+layout(std140) uniform SceneData
+{
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;
+    float u_Time;
+};
+
+uniform mat4 u_Transform;
+
+out vec4 v_Color;
+
+void main()
+{
+    v_Color = a_InstanceColor;
+    gl_Position = u_ViewProjection * u_Transform * a_InstanceTransform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+    color = v_Color;
+}
@@ -4,7 +4,15 @@
 layout(location = 0) in vec3 a_Position;
 layout(location = 1) in vec2 a_TexCoord;
 
-uniform mat4 u_ViewProjection;
+layout(std140) uniform SceneData
+{
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;
+    float u_Time;
+};
+
 uniform mat4 u_Transform;
 
 out vec2 v_TexCoord;
@@ -1,19 +1,25 @@
 #include "Hazel.h"
 #include "Hazel/Core/Core.h"
 
-#include "Platform/OpenGL/OpenGLShader.h"
-
 #include "imgui/imgui.h"
 
 #include <glm/ext/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <cstdlib>
+
 class ExampleLayer : public Hazel::Layer
 {
 public:
-    ExampleLayer() : Layer("Example"), m_CameraController(1280.0f / 720.0f)
+    // NOTE: The camera controller only reacts to scrolling and window resizes
+    ExampleLayer()
+        : Layer("Example", Hazel::EventCategoryMouse | Hazel::EventCategoryApplication),
+          m_CameraController(1280.0f / 720.0f)
     {
-        m_VertexArray.reset(Hazel::VertexArray::Create());
+        // NOTE: OnUpdate only moves the camera from the input snapshot; all drawing happens in OnRender
+        SetConcurrentUpdate(true);
+
+        m_VertexArray = Hazel::VertexArray::Create();
 
         float vertices[3 * 7] = {
             -0.5f, -0.5f, 0.0f, 0.8f, 0.2f, 0.8f, 1.0f, // Pinkish
@@ -21,8 +27,7 @@ public:
             0.0f,  0.5f,  0.0f, 0.8f, 0.8f, 0.2f, 1.0f  // Yellowish
         };
 
-        Hazel::Ref<Hazel::VertexBuffer> vertexBuffer;
-        vertexBuffer.reset(Hazel::VertexBuffer::Create(vertices, sizeof(vertices)));
+        Hazel::Ref<Hazel::VertexBuffer> vertexBuffer = Hazel::VertexBuffer::Create(vertices, sizeof(vertices));
 
         vertexBuffer->SetLayout(
             {{Hazel::ShaderDataType::Float3, "a_Position"}, {Hazel::ShaderDataType::Float4, "a_Color"}});
@@ -31,11 +36,10 @@ public:
         unsigned int indices[3] = {0, 1, 2};
         const uint32_t indexCount = sizeof(indices) / sizeof(uint32_t);
 
-        Hazel::Ref<Hazel::IndexBuffer> indexBuffer;
-        indexBuffer.reset(Hazel::IndexBuffer::Create(indices, indexCount));
+        Hazel::Ref<Hazel::IndexBuffer> indexBuffer = Hazel::IndexBuffer::Create(indices, indexCount);
         m_VertexArray->SetIndexBuffer(indexBuffer);
 
-        m_SquareVA.reset(Hazel::VertexArray::Create());
+        m_SquareVA = Hazel::VertexArray::Create();
 
         float squareVertices[5 * 4] = {
             -0.5f, -0.5f, 0.0f, 0.0f, 0.0f, // Bottom-left
@@ -44,25 +48,56 @@ public:
             -0.5f, 0.5f,  0.0f, 0.0f, 1.0f  // Top-left
         };
 
-        Hazel::Ref<Hazel::VertexBuffer> squareVB;
-        squareVB.reset(Hazel::VertexBuffer::Create(squareVertices, sizeof(squareVertices)));
+        Hazel::Ref<Hazel::VertexBuffer> squareVB = Hazel::VertexBuffer::Create(squareVertices, sizeof(squareVertices));
         squareVB->SetLayout(
             {{Hazel::ShaderDataType::Float3, "a_Position"}, {Hazel::ShaderDataType::Float2, "a_TexCoord"}});
         m_SquareVA->AddVertexBuffer(squareVB);
 
         unsigned int squareIndices[6] = {0, 1, 2, 2, 3, 0};
         const uint32_t squareIndexCount = sizeof(squareIndices) / sizeof(uint32_t);
-        Hazel::Ref<Hazel::IndexBuffer> squareIB;
-        squareIB.reset(Hazel::IndexBuffer::Create(squareIndices, squareIndexCount));
+        Hazel::Ref<Hazel::IndexBuffer> squareIB = Hazel::IndexBuffer::Create(squareIndices, squareIndexCount);
         m_SquareVA->SetIndexBuffer(squareIB);
 
+        // Instanced grid: shares the square geometry, adds a per-instance transform and color stream
+        std::vector<InstanceData> instances;
+        instances.reserve(s_InstanceGridSize * s_InstanceGridSize);
+        for (uint32_t y = 0; y < s_InstanceGridSize; y++)
+        {
+            for (uint32_t x = 0; x < s_InstanceGridSize; x++)
+            {
+                InstanceData instance;
+                instance.Transform = glm::translate(glm::mat4(1.0f), glm::vec3(x * 0.11f, -(y + 1) * 0.11f, 0.0f)) *
+                                     glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
+                instance.Color = {(float)x / s_InstanceGridSize, (float)y / s_InstanceGridSize, 0.6f, 1.0f};
+                instances.push_back(instance);
+            }
+        }
+
+        Hazel::Ref<Hazel::VertexBuffer> instanceVB = Hazel::VertexBuffer::Create(
+            reinterpret_cast<float*>(instances.data()), (uint32_t)(instances.size() * sizeof(InstanceData)));
+        instanceVB->SetLayout({{Hazel::ShaderDataType::Mat4, "a_InstanceTransform", false, 1},
+                               {Hazel::ShaderDataType::Float4, "a_InstanceColor", false, 1}});
+
+        m_InstancedVA = Hazel::VertexArray::Create();
+        m_InstancedVA->AddVertexBuffer(squareVB);
+        m_InstancedVA->AddVertexBuffer(instanceVB);
+        m_InstancedVA->SetIndexBuffer(squareIB);
+
         std::string vertexSource = R"(
 			#version 330 core
 
 			layout(location = 0) in vec3 a_Position;
 			layout(location = 1) in vec4 a_Color;
 
-			uniform mat4 u_ViewProjection;
+			layout(std140) uniform SceneData
+			{
+				mat4 u_View;
+				mat4 u_Projection;
+				mat4 u_ViewProjection;
+				vec2 u_ViewportSize;
+				float u_Time;
+			};
+
 			uniform mat4 u_Transform;
 
 			out vec3 v_Position;
@@ -93,81 +128,49 @@ public:
 
         m_Shader = Hazel::Shader::Create("VertexPosColor", vertexSource, fragmentSource);
 
-        std::string flatColorShaderVertexSource = R"(
-			#version 330 core
-
-			layout(location = 0) in vec3 a_Position;
-
-			uniform mat4 u_ViewProjection;
-			uniform mat4 u_Transform;
-
-			out vec3 v_Position;
-
-			void main()
-			{
-				v_Position = a_Position;
-				gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
-			}
-		)";
-
-        std::string flatColorShaderFragmentSource = R"(
-			#version 330 core
-
-			layout(location = 0) out vec4 color;
-
-			in vec3 v_Position;
-
-			uniform vec3 u_Color;
-
-			void main()
-			{
-				color = vec4(u_Color, 1.0);
-			}
-		)";
-
-        m_FlatColorShader =
-            Hazel::Shader::Create("FlatColor", flatColorShaderVertexSource, flatColorShaderFragmentSource);
-
         auto textureShader = m_ShaderLibrary.Load("assets/shaders/Texture.glsl");
+        m_ShaderLibrary.Load("assets/shaders/Instanced.glsl");
 
         m_Texture = Hazel::Texture2D::Create("assets/textures/Checkerboard.png");
 
         textureShader->Bind();
-        auto textureShaderOpenGL = std::dynamic_pointer_cast<Hazel::OpenGLShader>(textureShader);
-        textureShaderOpenGL->UploadUniformInt("u_Texture", 0);
+        textureShader->SetInt("u_Texture", 0);
     }
 
     void OnUpdate(Hazel::Timestep ts) override
     {
-        // Update
         m_CameraController.OnUpdate(ts);
+        // NOTE: A held key sends no further events, so keep frames coming while the camera moves
+        if (m_CameraController.IsMoving())
+            Invalidate();
+    }
 
-        // Render
+    void OnRender() override
+    {
         Hazel::RenderCommand::SetClearColor(glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
         Hazel::RenderCommand::Clear();
 
-        Hazel::Renderer::BeginScene(m_CameraController.GetCamera());
-
-        glm::mat4 scale = glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
-
-        m_FlatColorShader->Bind();
-        auto flatColorShader = std::dynamic_pointer_cast<Hazel::OpenGLShader>(m_FlatColorShader);
-        flatColorShader->UploadUniformFloat3("u_Color", m_SquareColor);
+        Hazel::Renderer2D::BeginScene(m_CameraController.GetCamera());
 
+        const glm::vec4 squareColor(m_SquareColor, 1.0f);
         for (int y = 0; y < 20; y++)
         {
             for (int x = 0; x < 20; x++)
             {
-                glm::vec3 pos(x * 0.11f, y * 0.11f, 0.0f);
-                glm::mat4 transform = glm::translate(glm::mat4(1.0f), pos) * scale;
-                Hazel::Renderer::Submit(m_FlatColorShader, m_SquareVA, transform);
+                glm::vec2 pos(x * 0.11f, y * 0.11f);
+                Hazel::Renderer2D::DrawQuad(pos, {0.1f, 0.1f}, squareColor);
             }
         }
 
+        Hazel::Renderer2D::EndScene();
+
+        Hazel::Renderer::BeginScene(m_CameraController.GetCamera());
+
         auto textureShader = m_ShaderLibrary.Get("Texture");
 
-        m_Texture->Bind();
-        Hazel::Renderer::Submit(textureShader, m_SquareVA, glm::scale(glm::mat4(1.0f), glm::vec3(1.5f)));
+        Hazel::Renderer::Submit(textureShader, m_SquareVA, m_Texture, glm::scale(glm::mat4(1.0f), glm::vec3(1.5f)));
+        Hazel::Renderer::SubmitInstanced(m_ShaderLibrary.Get("Instanced"), m_InstancedVA,
+                                         s_InstanceGridSize * s_InstanceGridSize);
 
         Hazel::Renderer::EndScene();
     }
@@ -177,6 +180,53 @@ public:
         ImGui::Begin("Settings");
         ImGui::ColorEdit3("Square Color", glm::value_ptr(m_SquareColor));
         ImGui::End();
+
+        const Hazel::FrameStatistics& frameStats = Hazel::Application::Get().GetFrameStatistics();
+        const Hazel::FrameTimeSummary& frameSummary = frameStats.GetSummary();
+        ImGui::Begin("Frame Statistics");
+        ImGui::Text("p50 %.2f ms  p95 %.2f ms  p99 %.2f ms  max %.2f ms", frameSummary.P50, frameSummary.P95,
+                    frameSummary.P99, frameSummary.Max);
+        ImGui::Text("Over budget: %u of %u frames", frameStats.GetFramesOverBudget(), frameStats.GetFrameCount());
+        float histogram[Hazel::FrameStatistics::HistogramBucketCount];
+        for (uint32_t i = 0; i < Hazel::FrameStatistics::HistogramBucketCount; i++)
+            histogram[i] = (float)frameStats.GetHistogram()[i];
+        ImGui::PlotHistogram("Frame time (1 ms buckets)", histogram, Hazel::FrameStatistics::HistogramBucketCount);
+
+        const Hazel::FramePacingSummary& pacing = Hazel::Application::Get().GetFramePacer().GetSummary();
+        ImGui::Text("Pacing: interval %.2f ms  jitter %.2f ms  max deviation %.2f ms  late %u", pacing.Interval,
+                    pacing.Jitter, pacing.MaxDeviation, pacing.LateFrames);
+
+        const Hazel::RenderStatistics renderStats = Hazel::Renderer::GetStats();
+        ImGui::Text("Draws %llu  Indices %llu  Instances %llu", (unsigned long long)renderStats.DrawCalls,
+                    (unsigned long long)renderStats.Indices, (unsigned long long)renderStats.Instances);
+        ImGui::Text("Binds: shader %llu  texture %llu  vertex array %llu", (unsigned long long)renderStats.ShaderBinds,
+                    (unsigned long long)renderStats.TextureBinds, (unsigned long long)renderStats.VertexArrayBinds);
+        ImGui::Text("Uploaded: buffers %llu B  textures %llu B", (unsigned long long)renderStats.BufferBytesUploaded,
+                    (unsigned long long)renderStats.TextureBytesUploaded);
+        ImGui::End();
+
+        if (Hazel::AllocationTracker::IsEnabled())
+        {
+            const Hazel::AllocationStatistics memory = Hazel::AllocationTracker::GetStatistics();
+            ImGui::Begin("Memory");
+            ImGui::Text("Last frame: %llu allocations, %llu bytes", (unsigned long long)memory.FrameAllocations,
+                        (unsigned long long)memory.FrameBytes);
+            ImGui::Text("Live: %llu bytes in %llu allocations (peak %llu)", (unsigned long long)memory.LiveBytes,
+                        (unsigned long long)memory.LiveAllocations, (unsigned long long)memory.PeakBytes);
+            for (const Hazel::AllocationTagStatistics& tag : Hazel::AllocationTracker::GetTagStatistics())
+                ImGui::Text("%-12s %6llu allocs/frame  %8llu live bytes", tag.Name,
+                            (unsigned long long)tag.FrameAllocations, (unsigned long long)tag.LiveBytes);
+            ImGui::End();
+        }
+
+        ImGui::Begin("GPU Timings");
+        bool drawTiming = Hazel::GPUProfiler::IsDrawTimingEnabled();
+        if (ImGui::Checkbox("Per-draw timing", &drawTiming))
+            Hazel::GPUProfiler::SetDrawTimingEnabled(drawTiming);
+        for (const Hazel::GPUProfileResult& result : Hazel::GPUProfiler::GetResults())
+            ImGui::Text("%*s%s %u: %.3f ms", (int)result.Depth * 2, "", result.Name, result.Index,
+                        result.Milliseconds);
+        ImGui::End();
     }
 
     void OnEvent(Hazel::Event& e) override
@@ -185,12 +235,20 @@ public:
     }
 
 private:
+    struct InstanceData
+    {
+        glm::mat4 Transform;
+        glm::vec4 Color;
+    };
+
+    static constexpr uint32_t s_InstanceGridSize = 50;
+
     Hazel::ShaderLibrary m_ShaderLibrary;
     Hazel::Ref<Hazel::Shader> m_Shader;
     Hazel::Ref<Hazel::VertexArray> m_VertexArray;
 
-    Hazel::Ref<Hazel::Shader> m_FlatColorShader;
     Hazel::Ref<Hazel::VertexArray> m_SquareVA;
+    Hazel::Ref<Hazel::VertexArray> m_InstancedVA;
 
     Hazel::Ref<Hazel::Texture2D> m_Texture;
 
@@ -198,10 +256,24 @@ private:
     glm::vec3 m_SquareColor = {0.2f, 0.3f, 0.8f};
 };
 
+// HAZEL_RECORD_INPUT=<file> records a session; HAZEL_REPLAY_INPUT=<file> plays it back frame for frame.
+// HAZEL_RENDER_ON_DEMAND=1 only draws when something changed.
+static Hazel::ApplicationSpecification GetSandboxSpecification()
+{
+    Hazel::ApplicationSpecification specification;
+    if (const char* path = std::getenv("HAZEL_RECORD_INPUT"))
+        specification.RecordInputPath = path;
+    if (const char* path = std::getenv("HAZEL_REPLAY_INPUT"))
+        specification.ReplayInputPath = path;
+    if (std::getenv("HAZEL_RENDER_ON_DEMAND"))
+        specification.RenderOnDemand = true;
+    return specification;
+}
+
 class Sandbox : public Hazel::Application
 {
 public:
-    Sandbox()
+    Sandbox() : Hazel::Application(GetSandboxSpecification())
     {
         PushLayer(new ExampleLayer());
     }
@@ -8,6 +8,18 @@ workspace "Hazel"
 
 	startproject "Sandbox"
 
+newoption
+{
+	trigger = "profile",
+	description = "Record HZ_PROFILE_* scopes to Chrome trace files"
+}
+
+newoption
+{
+	trigger = "track-memory",
+	description = "Count every allocation per frame and HZ_MEMORY_SCOPE tag"
+}
+
 outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
 
 -- Include directories relative to root folder (solution directory)
@@ -38,6 +50,17 @@ filter "system:windows"
 filter "system:macosx"
 	architecture "ARM64"
 
+filter "system:linux"
+	architecture "x86_64"
+
+-- Compiles the HZ_PROFILE_* instrumentation in, in any configuration (see Hazel/src/Hazel/Debug/Instrumentor.h)
+filter "options:profile"
+	defines "HZ_PROFILE=1"
+
+-- Replaces the global operator new/delete with counting versions (see Hazel/src/Hazel/Debug/AllocationTracker.h)
+filter "options:track-memory"
+	defines "HZ_TRACK_MEMORY=1"
+
 filter {}
 
 include "Hazel/vendor/GLFW"
@@ -139,6 +162,15 @@ project "Hazel"
 
 		pchheader "src/hzpch.h"
 
+	filter "system:linux"
+		defines
+		{
+			"HZ_PLATFORM_LINUX",
+			"GLFW_INCLUDE_NONE"
+		}
+
+		pchheader "src/hzpch.h"
+
 	filter "configurations:Debug"
 		defines "HZ_DEBUG"
 		runtime "Debug"
@@ -221,6 +253,23 @@ project "Sandbox"
 			"OpenGL.framework"
 		}
 
+	filter "system:linux"
+		defines
+		{
+			"HZ_PLATFORM_LINUX"
+		}
+
+		-- NOTE: Static libraries do not carry their dependencies into the link on Linux
+		links
+		{
+			"GLFW",
+			"Glad",
+			"ImGui",
+			"X11",
+			"dl",
+			"pthread"
+		}
+
 	filter "configurations:Debug"
 		defines "HZ_DEBUG"
 		runtime "Debug"
@@ -304,6 +353,23 @@ project "Hazel-Test"
 			"OpenGL.framework"
 		}
 
+	filter "system:linux"
+		defines
+		{
+			"HZ_PLATFORM_LINUX"
+		}
+
+		-- NOTE: Static libraries do not carry their dependencies into the link on Linux
+		links
+		{
+			"GLFW",
+			"Glad",
+			"ImGui",
+			"X11",
+			"dl",
+			"pthread"
+		}
+
 	filter "configurations:Debug"
 		defines "HZ_DEBUG"
 		runtime "Debug"
@@ -324,4 +390,98 @@ project "Hazel-Test"
 		runtime "Release"
 		optimize "on"
 
+project "Hazel-Bench"
+	location "Hazel-Bench"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "on"
+
+	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"%{prj.name}/src/**.h",
+		"%{prj.name}/src/**.cpp"
+	}
+
+	includedirs
+	{
+		"Hazel/vendor/spdlog/include",
+		"Hazel/src",
+		"Hazel/vendor",
+		"%{IncludeDir.glm}"
+	}
+
+	externalincludedirs
+	{
+		"Hazel/vendor/spdlog/include",
+		"%{IncludeDir.glm}"
+	}
+
+	links
+	{
+		"Hazel"
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+
+		defines
+		{
+			"HZ_PLATFORM_WINDOWS"
+		}
+
+		buildoptions { "/utf-8" }
+
+	filter "system:macosx"
+		defines
+		{
+			"HZ_PLATFORM_MACOS",
+			"GLFW_INCLUDE_NONE",
+			"GL_SILENCE_DEPRECATION"
+		}
+
+		links
+		{
+			"Cocoa.framework",
+			"IOKit.framework",
+			"CoreVideo.framework",
+			"OpenGL.framework"
+		}
+
+	filter "system:linux"
+		defines
+		{
+			"HZ_PLATFORM_LINUX"
+		}
+
+		-- NOTE: Static libraries do not carry their dependencies into the link on Linux
+		links
+		{
+			"GLFW",
+			"Glad",
+			"ImGui",
+			"X11",
+			"dl",
+			"pthread"
+		}
+
+	-- NOTE: Numbers from Debug builds are not comparable to anything; track Release
+	filter "configurations:Debug"
+		defines "HZ_DEBUG"
+		runtime "Debug"
+		symbols "on"
+
+	filter "configurations:Release"
+		defines "HZ_RELEASE"
+		runtime "Release"
+		optimize "on"
+
+	filter "configurations:Dist"
+		defines "HZ_DIST"
+		runtime "Release"
+		optimize "on"
+
 filter {}